@@ -0,0 +1,452 @@
+#ifndef BATCH_SOLVERS_HPP
+#define BATCH_SOLVERS_HPP
+
+#include "simd.hpp"
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <limits>
+
+/*
+Métodos em lote para varrer uma família de funções f(p, x) indexada por um parâmetro p (por exemplo, a família
+RocketFamily de rocket_family.hpp, onde p = a). Cada lane SIMD resolve um valor de p diferente, com máscaras de
+convergência independentes por lane: uma lane que já convergiu tem seu resultado congelado enquanto as demais
+continuam iterando.
+
+A entrada segue o formato structure-of-arrays (um vetor para os parâmetros, outro para os extremos inferiores, etc.)
+e a saída é um BatchResult, também em structure-of-arrays. Os critérios de parada de cada lane são os mesmos dos
+métodos escalares de generic_solvers.hpp; como simd::log difere de std::log em até 2 ulp, raramente uma lane pode
+terminar uma iteração antes ou depois da versão escalar quando o critério está no limite da tolerância.
+
+A família deve fornecer f(p, x) (e df(p, x) para Newton-Raphson) como templates em V, para V = simd::vdouble.
+*/
+
+// Resultados em lote. A posição i de cada vetor corresponde ao i-ésimo parâmetro da entrada
+struct BatchResult {
+    std::vector<double> root;
+    std::vector<double> residual;
+    std::vector<double> error;
+    std::vector<unsigned char> converged;
+    std::vector<int> interations;
+    std::vector<int> function_evaluations;
+    std::vector<int> interations_float; // Interações feitas em float (métodos de precisão mista), já incluídas em interations
+
+    void resize(std::size_t n){
+        root.resize(n);
+        residual.resize(n);
+        error.resize(n);
+        converged.resize(n);
+        interations.resize(n);
+        function_evaluations.resize(n);
+        interations_float.resize(n);
+    }
+};
+
+namespace batch_detail {
+
+// Carrega as lanes [i, i + width) de p, repetindo o último elemento quando o bloco ultrapassa n
+inline simd::vdouble gather(const double* p, std::size_t i, std::size_t n){
+    if(i + simd::width <= n){
+        return simd::load(p + i);
+    }
+    simd::vdouble v;
+    for(int l = 0; l < simd::width; l++){
+        v[l] = p[std::min(i + l, n - 1)];
+    }
+    return v;
+}
+
+// Estado do resultado de um bloco de lanes, atualizado à medida que as lanes convergem.
+// Os contadores ficam em vdouble para que toda a seleção por máscara use operações de ponto flutuante,
+// disponíveis em qualquer largura (blends de inteiros de 64 bits não existem em SSE2/SIMD128)
+struct LaneResults {
+    simd::vdouble root, residual, error, interations, evaluations;
+    simd::vmask converged;
+    simd::vdouble interations_float{};
+
+    // Registra o resultado nas lanes marcadas por m
+    void set(simd::vmask m, simd::vdouble x, simd::vdouble res, simd::vdouble err, simd::vmask conv, double k, double evals){
+        root = simd::select(m, x, root);
+        residual = simd::select(m, res, residual);
+        error = simd::select(m, err, error);
+        interations = simd::select(m, simd::splat(k), interations);
+        evaluations = simd::select(m, simd::splat(evals), evaluations);
+        converged = (m & conv) | (~m & converged);
+    }
+
+    void scatter(BatchResult& out, std::size_t i, std::size_t n) const {
+        for(int l = 0; l < simd::width && i + l < n; l++){
+            out.root[i + l] = root[l];
+            out.residual[i + l] = residual[l];
+            out.error[i + l] = error[l];
+            out.converged[i + l] = converged[l] != 0;
+            out.interations[i + l] = (int)interations[l];
+            out.function_evaluations[i + l] = (int)evaluations[l];
+            out.interations_float[i + l] = (int)interations_float[l];
+        }
+    }
+};
+
+// Lanes com intervalo inválido (f(a) e f(b) com o mesmo sinal) não iteram e retornam root = NaN
+inline LaneResults invalid_lanes(){
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    return {simd::splat(nan), simd::splat(nan), simd::splat(nan), simd::vdouble{}, simd::splat(2), simd::vmask{}};
+}
+
+// Lanes com v finito (falso para NaN e ±inf)
+inline simd::vmask finite(simd::vdouble v){
+    return simd::abs(v) <= std::numeric_limits<double>::max();
+}
+
+} // namespace batch_detail
+
+// Método da bissecção em lote
+template <class Family>
+void batch_bisection(const Family& family, const double* params, const double* a, const double* b, std::size_t n,
+                     double epsilon, int max_inter, BatchResult& out){
+/*
+Aplica o método da bissecção para cada i em [0, n), resolvendo f(params[i], x) = 0 no intervalo [a[i], b[i]].
+Diferente da versão escalar, um intervalo inválido não lança exceção: a posição correspondente retorna
+converged = false, interations = 0 e root = NaN.
+    Args:
+        (Family) family: Família de funções f(p, x)
+        (const double*) params, a, b: Vetores de tamanho n com os parâmetros e os extremos dos intervalos
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (BatchResult&) out: Resultados, redimensionado para n posições
+*/
+    out.resize(n);
+    for(std::size_t i = 0; i < n; i += simd::width){
+        simd::vdouble p = batch_detail::gather(params, i, n);
+        simd::vdouble va = batch_detail::gather(a, i, n);
+        simd::vdouble vb = batch_detail::gather(b, i, n);
+        simd::vdouble fa = family.f(p, va);
+        simd::vdouble fb = family.f(p, vb);
+
+        batch_detail::LaneResults r = batch_detail::invalid_lanes();
+        simd::vmask active = fa * fb < 0;
+        simd::vdouble x = va, fx = fa;
+
+        for(int k = 1; k <= max_inter && simd::any(active); k++){
+            x = 0.5 * (va + vb);
+            fx = family.f(p, x);
+            simd::vdouble width = vb - va;
+            simd::vmask done = active & (width < epsilon);
+            r.set(done, x, simd::abs(fx), simd::abs(width), done, k, 2 + k);
+            active &= ~done;
+
+            // Escolha dos extremos do intervalo da próxima interação, apenas nas lanes ativas
+            simd::vmask same = fx * fa > 0;
+            va = simd::select(active & same, x, va);
+            fa = simd::select(active & same, fx, fa);
+            vb = simd::select(active & ~same, x, vb);
+            fb = simd::select(active & ~same, fx, fb);
+        }
+        // Lanes que atingiram max_inter sem convergir
+        r.set(active, x, simd::abs(fx), simd::abs(vb - va), simd::vmask{}, max_inter, 2 + max_inter);
+        r.scatter(out, i, n);
+    }
+}
+
+// Método da posição falsa em lote
+template <class Family>
+void batch_false_position(const Family& family, const double* params, const double* a, const double* b, std::size_t n,
+                          double epsilon, int max_inter, BatchResult& out){
+/*
+Aplica o método da posição falsa para cada i em [0, n), resolvendo f(params[i], x) = 0 no intervalo [a[i], b[i]].
+Argumentos e tratamento de intervalos inválidos iguais aos de batch_bisection.
+*/
+    out.resize(n);
+    for(std::size_t i = 0; i < n; i += simd::width){
+        simd::vdouble p = batch_detail::gather(params, i, n);
+        simd::vdouble va = batch_detail::gather(a, i, n);
+        simd::vdouble vb = batch_detail::gather(b, i, n);
+        simd::vdouble fa = family.f(p, va);
+        simd::vdouble fb = family.f(p, vb);
+
+        batch_detail::LaneResults r = batch_detail::invalid_lanes();
+        simd::vmask active = fa * fb < 0;
+        simd::vdouble x = va, fx = fa;
+
+        for(int k = 1; k <= max_inter && simd::any(active); k++){
+            x = (va*fb - vb*fa)/(fb - fa);
+            fx = family.f(p, x);
+            simd::vdouble width = simd::abs(vb - va);
+            simd::vmask done = active & (width < epsilon);
+            r.set(done, x, simd::abs(fx), width, done, k, 2 + k);
+            active &= ~done;
+
+            simd::vmask same = fx * fa > 0;
+            va = simd::select(active & same, x, va);
+            fa = simd::select(active & same, fx, fa);
+            vb = simd::select(active & ~same, x, vb);
+            fb = simd::select(active & ~same, fx, fb);
+
+            // Critério de parada |f(x)| < epsilon
+            simd::vmask small = active & (simd::abs(fx) < epsilon);
+            r.set(small, x, simd::abs(fx), simd::abs(fx), small, k, 2 + k);
+            active &= ~small;
+        }
+        r.set(active, x, simd::abs(fx), simd::abs(vb - va), simd::vmask{}, max_inter, 2 + max_inter);
+        r.scatter(out, i, n);
+    }
+}
+
+// Método de Newton-Raphson em lote
+template <class Family>
+void batch_newton_raphson(const Family& family, const double* params, const double* x0, std::size_t n,
+                          double epsilon, int max_inter, BatchResult& out){
+/*
+Aplica o método de Newton-Raphson para cada i em [0, n), resolvendo f(params[i], x) = 0 a partir de x0[i]. Como na
+versão escalar, uma lane com derivada nula ou passo (ou f) não finito para com converged = false e error = inf, na
+última aproximação finita, sem prender as demais lanes do vetor até max_inter.
+    Args:
+        (Family) family: Família de funções f(p, x), com derivada df(p, x) em relação a x
+        (const double*) params, x0: Vetores de tamanho n com os parâmetros e as aproximações iniciais
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (BatchResult&) out: Resultados, redimensionado para n posições
+*/
+    out.resize(n);
+    for(std::size_t i = 0; i < n; i += simd::width){
+        simd::vdouble p = batch_detail::gather(params, i, n);
+        simd::vdouble xp = batch_detail::gather(x0, i, n);
+        simd::vdouble fxp = family.f(p, xp);
+
+        batch_detail::LaneResults r = batch_detail::invalid_lanes();
+        simd::vmask active = ~simd::vmask{};
+        simd::vdouble x = xp, fx = fxp, step = simd::vdouble{};
+
+        for(int k = 1; k <= max_inter && simd::any(active); k++){
+            x = xp - fxp/family.df(p, xp);
+            fx = family.f(p, x);
+            // Salvaguarda de newton_raphson: com a derivada nula ou xk fora do domínio de f, a lane para sem
+            // convergência na última aproximação finita
+            simd::vmask broken = active & ~(batch_detail::finite(x) & batch_detail::finite(fx));
+            r.set(broken, xp, simd::abs(fxp), simd::splat(INFINITY), simd::vmask{}, k, 1 + 2*k);
+            active &= ~broken;
+            step = simd::abs(x - xp);
+            simd::vmask done = active & (step < epsilon);
+            r.set(done, x, simd::abs(fx), step, done, k, 1 + 2*k);
+            active &= ~done;
+
+            xp = simd::select(active, x, xp);
+            fxp = simd::select(active, fx, fxp);
+        }
+        r.set(active, x, simd::abs(fx), step, simd::vmask{}, max_inter, 1 + 2*max_inter);
+        r.scatter(out, i, n);
+    }
+}
+
+/*
+Métodos em precisão mista. A primeira fase itera em float, com o dobro de lanes por vetor (simd::vfloat), até a
+tolerância pedida ou até o limite da precisão simples (passo ou largura abaixo de MIXED_FLOAT_ULPS ulps de x); a
+segunda fase parte do resultado em float e refina em double até epsilon, normalmente em uma ou duas interações.
+Em BatchResult, interations e function_evaluations somam as duas fases e interations_float guarda as da primeira.
+
+A família deve fornecer f (e df para Newton-Raphson) também para V = simd::vfloat. Os parâmetros, extremos e x0 são
+convertidos para float na primeira fase, então devem estar no intervalo representável em float; lanes em que a fase
+em float não produz um valor finito recomeçam a fase em double a partir dos dados originais.
+*/
+const float MIXED_FLOAT_ULPS = 8;
+
+namespace batch_detail {
+
+// Carrega as lanes [i, i + width_f) de p convertidas para float, repetindo o último elemento após n
+inline simd::vfloat gather_f(const double* p, std::size_t i, std::size_t n){
+    simd::vfloat v;
+    for(int l = 0; l < simd::width_f; l++){
+        v[l] = (float)p[std::min(i + l, n - 1)];
+    }
+    return v;
+}
+
+// Tolerância da fase em float: epsilon ou o menor passo que a precisão simples ainda distingue em x
+inline simd::vfloat float_tolerance(simd::vfloat x, double epsilon){
+    simd::vfloat t = simd::abs(x) * (MIXED_FLOAT_ULPS * std::numeric_limits<float>::epsilon());
+    simd::vfloat e = simd::splat_f((float)epsilon);
+    return simd::select(t > e, t, e);
+}
+
+// Soma as interações e avaliações da fase em float às da fase em double
+inline void add_float_phase(LaneResults& r, simd::vdouble k_float, simd::vdouble evals_float){
+    r.interations += k_float;
+    r.evaluations += evals_float;
+    r.interations_float = k_float;
+}
+
+} // namespace batch_detail
+
+// Método da bissecção em precisão mista
+template <class Family>
+void batch_bisection_mixed(const Family& family, const double* params, const double* a, const double* b, std::size_t n,
+                           double epsilon, int max_inter, BatchResult& out){
+/*
+Bissecção em float até o intervalo ficar abaixo da tolerância de float, seguida de interações da secante em double
+(entre as duas últimas aproximações) protegidas pelo intervalo, em que um passo fora do intervalo vira um passo de
+bissecção, até |x_k - x_k-1| < epsilon.
+O erro reportado é esse último passo. Argumentos e tratamento de intervalos inválidos iguais aos de batch_bisection;
+o limite max_inter vale para a soma das duas fases.
+*/
+    out.resize(n);
+    for(std::size_t i = 0; i < n; i += simd::width_f){
+        simd::vfloat pf = batch_detail::gather_f(params, i, n);
+        simd::vfloat af = batch_detail::gather_f(a, i, n);
+        simd::vfloat bf = batch_detail::gather_f(b, i, n);
+        simd::vfloat faf = family.f(pf, af);
+        simd::vfloat fbf = family.f(pf, bf);
+
+        simd::vfmask active = faf * fbf < 0;
+        simd::vfloat kf{};
+        for(int k = 1; k < max_inter && simd::any(active); k++){
+            simd::vfloat x = 0.5f * (af + bf);
+            simd::vfloat fx = family.f(pf, x);
+            kf = simd::select(active, simd::splat_f(k), kf);
+            active &= ~(bf - af < batch_detail::float_tolerance(x, epsilon));
+
+            simd::vfmask same = fx * faf > 0;
+            af = simd::select(active & same, x, af);
+            faf = simd::select(active & same, fx, faf);
+            bf = simd::select(active & ~same, x, bf);
+        }
+
+        for(int h = 0; h < 2 && i + h * simd::width < n; h++){
+            std::size_t j = i + h * simd::width;
+            simd::vdouble p = batch_detail::gather(params, j, n);
+            simd::vdouble va = batch_detail::gather(a, j, n);
+            simd::vdouble vb = batch_detail::gather(b, j, n);
+            simd::vdouble fa = family.f(p, va);
+            simd::vdouble fb = family.f(p, vb);
+            simd::vmask valid = fa * fb < 0;
+
+            // Extremos do intervalo da fase em float que mantêm em double o sinal do extremo original correspondente.
+            // Perto da raíz o sinal de f em float pode estar errado; nesse caso o extremo original é mantido
+            simd::vdouble k_float = simd::select(valid, simd::to_double(kf, h), simd::vdouble{});
+            simd::vdouble lo = simd::to_double(af, h), hi = simd::to_double(bf, h);
+            simd::vdouble flo = family.f(p, lo), fhi = family.f(p, hi);
+            simd::vmask lo_ok = valid & (k_float > 0) & (flo * fa >= 0);
+            simd::vmask hi_ok = valid & (k_float > 0) & (fhi * fb >= 0);
+            va = simd::select(lo_ok, lo, va);
+            fa = simd::select(lo_ok, flo, fa);
+            vb = simd::select(hi_ok, hi, vb);
+            fb = simd::select(hi_ok, fhi, fb);
+            simd::vdouble evals_float = simd::select(valid, 2.0 + k_float, simd::vdouble{});
+
+            batch_detail::LaneResults r = batch_detail::invalid_lanes();
+            simd::vmask active_d = valid;
+            // Secante entre (xp, fxp) e (x, fx), começando pelos extremos do intervalo
+            simd::vdouble x = va, fx = fa, xp = vb, fxp = fb, step{};
+            // Lanes sem raíz exata em um extremo do intervalo
+            simd::vmask exact = active_d & (fa == 0.0);
+            r.set(exact, va, simd::vdouble{}, simd::vdouble{}, exact, 0, 2);
+            active_d &= ~exact;
+            exact = active_d & (fb == 0.0);
+            r.set(exact, vb, simd::vdouble{}, simd::vdouble{}, exact, 0, 2);
+            active_d &= ~exact;
+
+            for(int k = 1; simd::any(active_d); k++){
+                simd::vmask over = active_d & (k_float + k > max_inter);
+                r.set(over, x, simd::abs(fx), step, simd::vmask{}, k - 1, 1 + k);
+                active_d &= ~over;
+                if(!simd::any(active_d)){
+                    break;
+                }
+
+                simd::vdouble secant = x - fx*(x - xp)/(fx - fxp);
+                simd::vmask inside = (secant > simd::select(va < vb, va, vb)) & (secant < simd::select(va < vb, vb, va));
+                xp = x;
+                fxp = fx;
+                x = simd::select(inside, secant, 0.5 * (va + vb));
+                fx = family.f(p, x);
+                step = simd::abs(x - xp);
+                simd::vmask done = active_d & ((step < epsilon) | (fx == 0.0));
+                r.set(done, x, simd::abs(fx), step, done, k, 2 + k);
+                active_d &= ~done;
+
+                simd::vmask same = fx * fa > 0;
+                va = simd::select(active_d & same, x, va);
+                fa = simd::select(active_d & same, fx, fa);
+                vb = simd::select(active_d & ~same, x, vb);
+                fb = simd::select(active_d & ~same, fx, fb);
+            }
+            // As duas avaliações em double nos extremos do intervalo em float também contam
+            batch_detail::add_float_phase(r, k_float, simd::select(valid, evals_float + 2.0, simd::vdouble{}));
+            r.scatter(out, j, n);
+        }
+    }
+}
+
+// Método de Newton-Raphson em precisão mista
+template <class Family>
+void batch_newton_raphson_mixed(const Family& family, const double* params, const double* x0, std::size_t n,
+                                double epsilon, int max_inter, BatchResult& out){
+/*
+Newton-Raphson em float até o passo ficar abaixo da tolerância de float, seguido de Newton-Raphson em double a
+partir do resultado, até |x_k - x_k-1| < epsilon. Argumentos iguais aos de batch_newton_raphson; o limite max_inter
+vale para a soma das duas fases.
+*/
+    out.resize(n);
+    for(std::size_t i = 0; i < n; i += simd::width_f){
+        simd::vfloat pf = batch_detail::gather_f(params, i, n);
+        simd::vfloat xf = batch_detail::gather_f(x0, i, n);
+
+        simd::vfmask active = ~simd::vfmask{};
+        simd::vfloat kf{};
+        for(int k = 1; k < max_inter && simd::any(active); k++){
+            simd::vfloat x = xf - family.f(pf, xf)/family.df(pf, xf);
+            simd::vfmask finite = simd::abs(x) <= std::numeric_limits<float>::max();
+            kf = simd::select(active, simd::splat_f(k), kf);
+            // Com convergência quadrática o erro de x é da ordem de passo^2/|x|, então a fase em float termina quando
+            // essa estimativa fica abaixo da tolerância, sem a interação extra que só confirmaria o passo pequeno
+            simd::vfloat step = simd::abs(x - xf);
+            active &= finite & ~(step * step < batch_detail::float_tolerance(x, epsilon) * simd::abs(x));
+            xf = simd::select(finite, x, xf);
+        }
+
+        for(int h = 0; h < 2 && i + h * simd::width < n; h++){
+            std::size_t j = i + h * simd::width;
+            simd::vdouble p = batch_detail::gather(params, j, n);
+            simd::vdouble k_float = simd::to_double(kf, h);
+            simd::vdouble evals_float = 2.0 * k_float;
+            simd::vdouble xp = simd::to_double(xf, h);
+            simd::vdouble fxp = family.f(p, xp);
+            // Recomeço em double a partir de x0 quando a fase em float não chegou a um valor utilizável
+            simd::vmask restart = ~batch_detail::finite(fxp);
+            if(simd::any(restart)){
+                xp = simd::select(restart, batch_detail::gather(x0, j, n), xp);
+                fxp = family.f(p, xp);
+                evals_float = simd::select(restart, evals_float + 1.0, evals_float);
+            }
+            k_float = simd::select(restart, simd::vdouble{}, k_float);
+
+            batch_detail::LaneResults r = batch_detail::invalid_lanes();
+            simd::vmask active_d = ~simd::vmask{};
+            simd::vdouble x = xp, fx = fxp, step{};
+            for(int k = 1; simd::any(active_d); k++){
+                simd::vmask over = active_d & (k_float + k > max_inter);
+                r.set(over, x, simd::abs(fx), step, simd::vmask{}, k - 1, 2*k - 1);
+                active_d &= ~over;
+                if(!simd::any(active_d)){
+                    break;
+                }
+
+                x = xp - fxp/family.df(p, xp);
+                fx = family.f(p, x);
+                simd::vmask broken = active_d & ~(batch_detail::finite(x) & batch_detail::finite(fx));
+                r.set(broken, xp, simd::abs(fxp), simd::splat(INFINITY), simd::vmask{}, k, 1 + 2*k);
+                active_d &= ~broken;
+                step = simd::abs(x - xp);
+                simd::vmask done = active_d & (step < epsilon);
+                r.set(done, x, simd::abs(fx), step, done, k, 1 + 2*k);
+                active_d &= ~done;
+
+                xp = simd::select(active_d, x, xp);
+                fxp = simd::select(active_d, fx, fxp);
+            }
+            batch_detail::add_float_phase(r, k_float, evals_float);
+            r.scatter(out, j, n);
+        }
+    }
+}
+
+#endif
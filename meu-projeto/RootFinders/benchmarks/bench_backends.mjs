@@ -0,0 +1,90 @@
+/*
+Compara os dois backends dos quadros numéricos em listas grandes de foguetes: o módulo WebAssembly (uma instância,
+como cada Web Worker da interface, incluindo a cópia das views feita por copyNumericBoards) e o addon nativo
+(native_addon.cpp) com 1 thread e com todas. Mede só o cálculo e a cópia dos resultados, sem o IPC do Electron.
+Também confere se os dois backends chegam aos mesmos resultados.
+
+Pré-requisitos (a partir de meu-projeto/):
+    npm run build:native                       # RootFinders/rootfinders_native.node
+    emcmake cmake -S RootFinders -B RootFinders/build-wasm && cmake --build RootFinders/build-wasm --target wasm_node
+Execução:
+    node RootFinders/benchmarks/bench_backends.mjs [--native arquivo.node] [--wasm main_node.mjs] [--trace]
+
+Um backend que não for encontrado é pulado.
+*/
+import { createRequire } from 'node:module';
+import { existsSync } from 'node:fs';
+import { fileURLToPath, pathToFileURL } from 'node:url';
+import path from 'node:path';
+
+const here = path.dirname(fileURLToPath(import.meta.url));
+const args = process.argv.slice(2);
+const option = (name, fallback) => {
+  const i = args.indexOf(name);
+  return i >= 0 && i + 1 < args.length ? args[i + 1] : fallback;
+};
+const nativePath = path.resolve(option('--native', path.join(here, '..', 'rootfinders_native.node')));
+const wasmPath = path.resolve(option('--wasm', path.join(here, '..', 'build-wasm', 'main_node.mjs')));
+const trace = args.includes('--trace');
+const epsilon = 1e-10;
+const maxIter = 100;
+
+const loadNative = () => {
+  if (!existsSync(nativePath)) {
+    console.log(`# addon nativo não encontrado (${nativePath})`);
+    return null;
+  }
+  return createRequire(import.meta.url)(nativePath);
+};
+
+const loadWasm = async () => {
+  if (!existsSync(wasmPath)) {
+    console.log(`# módulo WASM para o Node não encontrado (${wasmPath})`);
+    return null;
+  }
+  const { default: Module } = await import(pathToFileURL(wasmPath).href);
+  return Module();
+};
+
+const native = loadNative();
+const wasm = await loadWasm();
+
+// Mesma cópia de copyNumericBoards (src/numericBoards.ts)
+const wasmBoards = a => {
+  const raw = wasm.comparative_boards_numeric(a, epsilon, maxIter, trace);
+  return { count: raw.count, doubles: raw.doubles.slice(), ints: raw.ints.slice(), trace: raw.trace.slice() };
+};
+
+const time = async (body, reps) => {
+  await body();
+  const t0 = performance.now();
+  for (let r = 0; r < reps; r++) {
+    await body();
+  }
+  return (performance.now() - t0) / reps;
+};
+
+// Resultados iguais a menos dos índices do histórico, que dependem da ordem dos blocos
+const same = (x, y) => x.doubles.length === y.doubles.length
+  && x.doubles.every((v, i) => Object.is(v, y.doubles[i]))
+  && x.ints.every((v, i) => i % 5 === 3 || v === y.ints[i]);
+
+const threads = native ? native.threads() : 0;
+console.log(`# epsilon ${epsilon}, max_iter ${maxIter}, histórico ${trace ? 'sim' : 'não'}, ${threads} threads`);
+console.log(['foguetes', 'wasm ms', 'nativo 1t ms', `nativo ${threads}t ms`, 'ganho', 'iguais'].map(s => s.padStart(14)).join(''));
+
+for (const n of [1000, 10000, 100000, 300000]) {
+  const a = Float64Array.from({ length: n }, (_, i) => -5 + 10 * i / n);
+  const reps = n <= 10000 ? 20 : 3;
+  if (wasm) {
+    wasm.clear_cache(); // O cache de resultados tornaria as repetições gratuitas
+  }
+  const tWasm = wasm ? await time(() => { wasm.clear_cache(); return wasmBoards(a); }, reps) : NaN;
+  const tOne = native ? await time(() => native.comparativeBoards(a, epsilon, maxIter, trace, '', 1), reps) : NaN;
+  const tAll = native ? await time(() => native.comparativeBoards(a, epsilon, maxIter, trace, ''), reps) : NaN;
+  const equal = wasm && native ? same(wasmBoards(a), await native.comparativeBoards(a, epsilon, maxIter, trace, '')) : null;
+  const ms = t => Number.isNaN(t) ? '-' : t.toFixed(1);
+  const gain = tWasm / Math.min(tOne, tAll);
+  console.log([n, ms(tWasm), ms(tOne), ms(tAll), Number.isNaN(gain) ? '-' : gain.toFixed(2) + 'x', equal === null ? '-' : equal ? 'sim' : 'nao']
+    .map(s => String(s).padStart(14)).join(''));
+}
@@ -0,0 +1,140 @@
+/*
+Benchmark dos métodos em lote (batch_solvers.hpp) contra a versão escalar (generic_solvers.hpp) numa varredura
+densa de a para a família dos foguetes. Também confere se as duas versões concordam (iterações e raiz), e compara
+os métodos de precisão mista (fase em float seguida de refinamento em double) com os métodos em lote todos em double.
+
+Compilação (a partir de RootFinders/):
+    cmake -S . -B build -DROOTFINDERS_NATIVE=ON && cmake --build build --target bench_batch
+*/
+#include "../root_finders.hpp"
+#include "../generic_solvers.hpp"
+#include "../batch_solvers.hpp"
+#include "../rocket_family.hpp"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace std;
+
+template <class Run>
+double ns_per_solve(size_t n, int reps, Run&& run){
+    auto t0 = chrono::steady_clock::now();
+    for(int r = 0; r < reps; r++){
+        run();
+    }
+    auto t1 = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(t1 - t0).count() / (double(reps) * n);
+}
+
+// Conta as posições em que o resultado escalar e o em lote divergem
+size_t mismatches(const vector<Result>& scalar, const BatchResult& batch){
+    size_t count = 0;
+    for(size_t i = 0; i < scalar.size(); i++){
+        double tol = 1e-12 * max(1.0, abs(scalar[i].root));
+        if(scalar[i].interations != batch.interations[i] || abs(scalar[i].root - batch.root[i]) > tol){
+            count++;
+        }
+    }
+    return count;
+}
+
+int main(){
+    const size_t n = 100000;
+    const int reps = 5;
+    const double eps = 1e-10;
+    const int max_iter = 200;
+
+    // Mesmos barramentos e x0 de quadro_comparativo, para a em [-5, 5] sem o ponto a = 0
+    vector<double> as(n), lo(n), hi(n), x0(n);
+    for(size_t i = 0; i < n; i++){
+        as[i] = -5.0 + 10.0 * (i + 0.5) / n;
+        lo[i] = as[i] < 0 ? pow(3.0, as[i]) : pow(2.0, as[i]);
+        hi[i] = as[i] < 0 ? pow(2.0, as[i]) : pow(3.0, as[i]);
+        x0[i] = pow(2.7, as[i]);
+    }
+
+    RocketFamily family;
+    vector<Result> scalar(n);
+    BatchResult batch;
+
+    printf("lanes SIMD: %d\n", simd::width);
+    printf("%-16s %12s %12s %8s %12s\n", "metodo", "escalar", "lote", "ganho", "divergencias");
+
+    auto report = [&](const char* name, double ns_scalar, double ns_batch){
+        printf("%-16s %9.1f ns %9.1f ns %7.2fx %12zu\n", name, ns_scalar, ns_batch, ns_scalar / ns_batch, mismatches(scalar, batch));
+    };
+
+    double t_scalar = ns_per_solve(n, reps, [&]{
+        for(size_t i = 0; i < n; i++){
+            double a = as[i];
+            scalar[i] = generic::bisection([a](double d){ return a*d - d*log(d); }, lo[i], hi[i], eps, max_iter);
+        }
+    });
+    double t_batch = ns_per_solve(n, reps, [&]{
+        batch_bisection(family, as.data(), lo.data(), hi.data(), n, eps, max_iter, batch);
+    });
+    report("bisection", t_scalar, t_batch);
+
+    t_scalar = ns_per_solve(n, reps, [&]{
+        for(size_t i = 0; i < n; i++){
+            double a = as[i];
+            scalar[i] = generic::false_position([a](double d){ return a*d - d*log(d); }, lo[i], hi[i], eps, max_iter);
+        }
+    });
+    t_batch = ns_per_solve(n, reps, [&]{
+        batch_false_position(family, as.data(), lo.data(), hi.data(), n, eps, max_iter, batch);
+    });
+    report("false_position", t_scalar, t_batch);
+
+    t_scalar = ns_per_solve(n, reps, [&]{
+        for(size_t i = 0; i < n; i++){
+            double a = as[i];
+            scalar[i] = generic::newton_raphson([a](double d){ return a*d - d*log(d); },
+                                                [a](double d){ return a - log(d) - 1; }, x0[i], eps, max_iter);
+        }
+    });
+    t_batch = ns_per_solve(n, reps, [&]{
+        batch_newton_raphson(family, as.data(), x0.data(), n, eps, max_iter, batch);
+    });
+    report("newton_raphson", t_scalar, t_batch);
+
+    // Precisão mista contra o lote em double: tempo, maior erro relativo da raiz em relação a e^a e interações médias
+    // em cada precisão
+    printf("\nprecisao mista (lanes float: %d)\n", simd::width_f);
+    printf("%-16s %12s %12s %8s %10s %10s %10s\n", "metodo", "double", "misto", "ganho", "erro rel", "it float", "it double");
+    BatchResult mixed;
+    auto report_mixed = [&](const char* name, double ns_double, double ns_mixed){
+        double max_error = 0, it_float = 0, it_double = 0;
+        size_t failed = 0;
+        for(size_t i = 0; i < n; i++){
+            if(!mixed.converged[i]){
+                failed++;
+                continue;
+            }
+            max_error = max(max_error, abs(mixed.root[i] - exp(as[i])) / exp(as[i]));
+            it_float += mixed.interations_float[i];
+            it_double += mixed.interations[i] - mixed.interations_float[i];
+        }
+        printf("%-16s %9.1f ns %9.1f ns %7.2fx %10.1e %10.2f %10.2f", name, ns_double, ns_mixed, ns_double / ns_mixed,
+               max_error, it_float / n, it_double / n);
+        printf(failed ? "  (%zu sem convergir)\n" : "\n", failed);
+    };
+
+    t_batch = ns_per_solve(n, reps, [&]{
+        batch_bisection(family, as.data(), lo.data(), hi.data(), n, eps, max_iter, batch);
+    });
+    double t_mixed = ns_per_solve(n, reps, [&]{
+        batch_bisection_mixed(family, as.data(), lo.data(), hi.data(), n, eps, max_iter, mixed);
+    });
+    report_mixed("bisection", t_batch, t_mixed);
+
+    t_batch = ns_per_solve(n, reps, [&]{
+        batch_newton_raphson(family, as.data(), x0.data(), n, eps, max_iter, batch);
+    });
+    t_mixed = ns_per_solve(n, reps, [&]{
+        batch_newton_raphson_mixed(family, as.data(), x0.data(), n, eps, max_iter, mixed);
+    });
+    report_mixed("newton_raphson", t_batch, t_mixed);
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*
+Microbenchmark: custo por resolução (ns/solve) dos métodos chamados via std::function (root_finders.hpp)
+e via as versões templatizadas com lambda (generic_solvers.hpp), usando a família fa(a) do problema dos foguetes.
+
+Compilação (a partir de RootFinders/):
+    cmake -S . -B build && cmake --build build --target bench_callable
+*/
+#include "../root_finders.hpp"
+#include "../generic_solvers.hpp"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace std;
+
+// Impede que o compilador descarte os resultados
+static volatile double sink;
+
+template <class Solve>
+double ns_per_solve(const vector<double>& as, int reps, Solve&& solve){
+    double acc = 0;
+    auto t0 = chrono::steady_clock::now();
+    for(int r = 0; r < reps; r++){
+        for(double a: as){
+            acc += solve(a).root;
+        }
+    }
+    auto t1 = chrono::steady_clock::now();
+    sink = acc;
+    return chrono::duration<double, nano>(t1 - t0).count() / (double(reps) * as.size());
+}
+
+int main(){
+    // Valores de a em [-3, 3] (nenhum igual a 0, onde o barramento [2^a, 3^a] degenera)
+    vector<double> as;
+    for(int i = 0; i < 64; i++){
+        as.push_back(-3.0 + 6.0 * i / 63.0);
+    }
+    const int reps = 2000;
+    const double eps = 1e-7;
+    const int max_iter = 200;
+
+    auto lo = [](double a){ return a < 0 ? pow(3.0, a) : pow(2.0, a); };
+    auto hi = [](double a){ return a < 0 ? pow(2.0, a) : pow(3.0, a); };
+
+    printf("%-16s %14s %14s %8s\n", "metodo", "std::function", "template", "ganho");
+
+    auto report = [](const char* name, double ns_fn, double ns_tpl){
+        printf("%-16s %11.1f ns %11.1f ns %7.2fx\n", name, ns_fn, ns_tpl, ns_fn / ns_tpl);
+    };
+
+    report("bisection",
+        ns_per_solve(as, reps, [&](double a){
+            function<double(double)> f = [a](double d){ return a*d - d*log(d); };
+            return bisection(f, lo(a), hi(a), eps, max_iter);
+        }),
+        ns_per_solve(as, reps, [&](double a){
+            return generic::bisection([a](double d){ return a*d - d*log(d); }, lo(a), hi(a), eps, max_iter);
+        }));
+
+    report("false_position",
+        ns_per_solve(as, reps, [&](double a){
+            function<double(double)> f = [a](double d){ return a*d - d*log(d); };
+            return false_position(f, lo(a), hi(a), eps, max_iter);
+        }),
+        ns_per_solve(as, reps, [&](double a){
+            return generic::false_position([a](double d){ return a*d - d*log(d); }, lo(a), hi(a), eps, max_iter);
+        }));
+
+    // phi(d) = d + f(d)/2 possui e^a como ponto fixo atrativo (|phi'(e^a)| = 1/2)
+    report("fixed_point",
+        ns_per_solve(as, reps, [&](double a){
+            function<double(double)> phi = [a](double d){ return d + 0.5*(a*d - d*log(d)); };
+            return fixed_point(phi, pow(2.7, a), eps, max_iter);
+        }),
+        ns_per_solve(as, reps, [&](double a){
+            return generic::fixed_point([a](double d){ return d + 0.5*(a*d - d*log(d)); }, pow(2.7, a), eps, max_iter);
+        }));
+
+    report("newton_raphson",
+        ns_per_solve(as, reps, [&](double a){
+            function<double(double)> f = [a](double d){ return a*d - d*log(d); };
+            function<double(double)> df = [a](double d){ return a - log(d) - 1; };
+            return newton_raphson(f, df, pow(2.7, a), eps, max_iter);
+        }),
+        ns_per_solve(as, reps, [&](double a){
+            return generic::newton_raphson([a](double d){ return a*d - d*log(d); },
+                                           [a](double d){ return a - log(d) - 1; }, pow(2.7, a), eps, max_iter);
+        }));
+
+    // Derivada por diferenciação automática: f escrita uma vez, avaliada em números duais
+    report("newton_ad",
+        ns_per_solve(as, reps, [&](double a){
+            function<ad::Dual(ad::Dual)> f = [a](ad::Dual d){ return a*d - d*log(d); };
+            return newton_raphson_ad(f, pow(2.7, a), eps, max_iter);
+        }),
+        ns_per_solve(as, reps, [&](double a){
+            return generic::newton_raphson_ad([a](auto d){ return a*d - d*log(d); }, pow(2.7, a), eps, max_iter);
+        }));
+
+    report("halley",
+        ns_per_solve(as, reps, [&](double a){
+            function<ad::Dual2(ad::Dual2)> f = [a](ad::Dual2 d){ return a*d - d*log(d); };
+            return halley(f, pow(2.7, a), eps, max_iter);
+        }),
+        ns_per_solve(as, reps, [&](double a){
+            return generic::halley([a](auto d){ return a*d - d*log(d); }, pow(2.7, a), eps, max_iter);
+        }));
+
+    report("secant",
+        ns_per_solve(as, reps, [&](double a){
+            function<double(double)> f = [a](double d){ return a*d - d*log(d); };
+            return secant(f, pow(2.7, a), pow(2.72, a), eps, max_iter);
+        }),
+        ns_per_solve(as, reps, [&](double a){
+            return generic::secant([a](double d){ return a*d - d*log(d); }, pow(2.7, a), pow(2.72, a), eps, max_iter);
+        }));
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+Benchmark das varreduras por continuação (continuation.hpp) contra resoluções independentes a partir das
+aproximações fixas de quadro_comparativo (x0 = 2.7^a e barramento [2^a, 3^a]), para grades de a cada vez mais finas.
+Reporta interações médias por ponto, avaliações de f por ponto, recomeços e tempo por ponto.
+
+Compilação (a partir de RootFinders/):
+    cmake -S . -B build && cmake --build build --target bench_continuation
+*/
+#include "../root_finders.hpp"
+#include "../generic_solvers.hpp"
+#include "../continuation.hpp"
+#include "../rocket_family.hpp"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace std;
+
+void barramento(double a, double& lo, double& hi){
+    lo = a == 0 ? 0.98 : (a < 0 ? pow(3.0, a) : pow(2.0, a));
+    hi = a == 0 ? 1.02 : (a < 0 ? pow(2.0, a) : pow(3.0, a));
+}
+
+struct Stats {
+    double iterations = 0, evaluations = 0, ns = 0, max_error = 0;
+    int cold = 0;
+};
+
+template <class Run>
+Stats measure(const vector<double>& as, Run&& run){
+    BatchResult out;
+    auto t0 = chrono::steady_clock::now();
+    Stats s;
+    s.cold = run(out);
+    auto t1 = chrono::steady_clock::now();
+    s.ns = chrono::duration<double, nano>(t1 - t0).count() / as.size();
+    for(size_t i = 0; i < as.size(); i++){
+        s.iterations += out.interations[i];
+        s.evaluations += out.function_evaluations[i];
+        s.max_error = max(s.max_error, abs(out.root[i] - exp(as[i])) / exp(as[i]));
+    }
+    s.iterations /= as.size();
+    s.evaluations /= as.size();
+    return s;
+}
+
+void report(const char* name, const Stats& s){
+    printf("  %-22s %8.2f it %8.2f aval %8d recomeços %9.1f ns %10.1e erro rel.\n", name, s.iterations, s.evaluations, s.cold, s.ns, s.max_error);
+}
+
+int main(){
+    const double eps = 1e-10;
+    const int max_iter = 200;
+    RocketFamily family;
+    auto cold_x0 = [](double a){ return pow(2.7, a); };
+    auto cold_bracket = [](double a, double& lo, double& hi){ barramento(a, lo, hi); };
+
+    for(size_t n: {100, 10000, 1000000}){
+        // Grade de a em [-5, 5] (as varreduras aceitam qualquer ordem, mas grades densas normalmente já vêm ordenadas)
+        vector<double> as(n);
+        for(size_t i = 0; i < n; i++){
+            as[i] = -5.0 + 10.0 * i / (n - 1);
+        }
+        printf("n = %zu (da = %.1e)\n", n, 10.0 / (n - 1));
+
+        report("Newton frio", measure(as, [&](BatchResult& out){
+            out.resize(n);
+            for(size_t i = 0; i < n; i++){
+                double a = as[i];
+                continuation_detail::store(out, i, generic::newton_raphson([&](double d){ return family.f(a, d); },
+                    [&](double d){ return family.df(a, d); }, cold_x0(a), eps, max_iter));
+            }
+            return (int)n;
+        }));
+        report("Newton continuação", measure(as, [&](BatchResult& out){
+            return sweep_newton_raphson(family, as.data(), n, cold_x0, eps, max_iter, out);
+        }));
+        report("Brent frio", measure(as, [&](BatchResult& out){
+            out.resize(n);
+            for(size_t i = 0; i < n; i++){
+                double a = as[i], lo, hi;
+                barramento(a, lo, hi);
+                continuation_detail::store(out, i, generic::brent([&](double d){ return family.f(a, d); }, lo, hi, eps, max_iter));
+            }
+            return (int)n;
+        }));
+        report("Brent continuação", measure(as, [&](BatchResult& out){
+            return sweep_brent(family, as.data(), n, cold_bracket, eps, max_iter, out);
+        }));
+    }
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+Benchmark das expressões compiladas em tempo de execução (expression.hpp) contra as lambdas escritas à mão, na família
+fa(a) = ad - dln(d) do problema dos foguetes: custo por avaliação de f (escalar e em lote) e por resolução com
+Newton-Raphson (com a derivada simbólica) e Brent.
+
+Compilação (a partir de RootFinders/):
+    cmake -S . -B build && cmake --build build --target bench_expression
+*/
+#include "../root_finders.hpp"
+#include "../generic_solvers.hpp"
+#include "../expression.hpp"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace std;
+
+static volatile double sink;
+
+template <class Body>
+double ns_per_item(size_t items, int reps, Body&& body){
+    auto t0 = chrono::steady_clock::now();
+    for(int r = 0; r < reps; r++){
+        body();
+    }
+    auto t1 = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(t1 - t0).count() / (double(reps) * items);
+}
+
+int main(){
+    const double a = 1.5;
+    const double eps = 1e-10;
+    const int max_iter = 200;
+    auto f = [a](double d){ return a*d - d*log(d); };
+    auto df = [a](double d){ return a - log(d) - 1; };
+    Expression ef("a*d - d*log(d)", {"d"}, {{"a", a}});
+    Expression edf = ef.derivative();
+    printf("f: %zu instruções, f': %zu instruções\n\n", ef.program().size(), edf.program().size());
+
+    vector<double> xs(4096), out(xs.size());
+    for(size_t i = 0; i < xs.size(); i++){
+        xs[i] = 0.5 + 10.0 * i / xs.size();
+    }
+    const int reps = 2000;
+
+    double t_lambda = ns_per_item(xs.size(), reps, [&]{
+        for(size_t i = 0; i < xs.size(); i++) out[i] = f(xs[i]);
+        sink = out[0];
+    });
+    double t_expr = ns_per_item(xs.size(), reps, [&]{
+        for(size_t i = 0; i < xs.size(); i++) out[i] = ef(xs[i]);
+        sink = out[0];
+    });
+    double t_batch = ns_per_item(xs.size(), reps, [&]{
+        ef.eval(xs.data(), out.data(), xs.size());
+        sink = out[0];
+    });
+    printf("%-28s %9s %9s\n", "avaliação de f", "ns", "x lambda");
+    printf("%-28s %9.2f %9.2f\n", "lambda", t_lambda, 1.0);
+    printf("%-28s %9.2f %9.2f\n", "Expression (escalar)", t_expr, t_expr / t_lambda);
+    printf("%-28s %9.2f %9.2f\n\n", "Expression (lote)", t_batch, t_batch / t_lambda);
+
+    const int solves = 20000;
+    double x0 = pow(2.7, a), lo = pow(2.0, a), hi = pow(3.0, a);
+    double t_newton_lambda = ns_per_item(1, solves, [&]{ sink = generic::newton_raphson(f, df, x0, eps, max_iter).root; });
+    double t_newton_expr = ns_per_item(1, solves, [&]{ sink = generic::newton_raphson(ef, edf, x0, eps, max_iter).root; });
+    double t_brent_lambda = ns_per_item(1, solves, [&]{ sink = generic::brent(f, lo, hi, eps, max_iter).root; });
+    double t_brent_expr = ns_per_item(1, solves, [&]{ sink = generic::brent(ef, lo, hi, eps, max_iter).root; });
+    printf("%-28s %9s %9s\n", "resolução", "ns", "x lambda");
+    printf("%-28s %9.1f %9.2f\n", "newton_raphson (lambda)", t_newton_lambda, 1.0);
+    printf("%-28s %9.1f %9.2f\n", "newton_raphson (Expression)", t_newton_expr, t_newton_expr / t_newton_lambda);
+    printf("%-28s %9.1f %9.2f\n", "brent (lambda)", t_brent_lambda, 1.0);
+    printf("%-28s %9.1f %9.2f\n", "brent (Expression)", t_brent_expr, t_brent_expr / t_brent_lambda);
+    return 0;
+}
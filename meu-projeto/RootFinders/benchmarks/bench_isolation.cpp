@@ -0,0 +1,71 @@
+/*
+Benchmark do isolamento de raízes (root_isolation.hpp): tempo de find_all_roots sobre funções com raízes conhecidas,
+incluindo raízes exatamente sobre a grade inicial vizinhas de uma segunda raíz próxima (x = 0 é ponto da grade em
+[-1, 1] sempre que o número de células é par). Para cada função reporta as raízes encontradas contra as esperadas;
+raízes faltando ou repetidas fazem o programa terminar com código 1.
+
+Compilação (a partir de RootFinders/):
+    cmake -S . -B build && cmake --build build --target bench_isolation
+*/
+#include "../root_finders.hpp"
+#include "../root_isolation.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+struct Case {
+    const char* name;
+    function<double(double)> f;
+    double lo, hi;
+    vector<double> roots;   // Raízes exatas em [lo, hi], em ordem crescente
+};
+
+int main(){
+    const double eps = 1e-10;
+    const int repetitions = 20;
+    WorkStealingPool pool(max(1u, thread::hardware_concurrency()));
+
+    vector<Case> cases = {
+        {"x(x - 0.001)", [](double x){ return x*(x - 0.001); }, -1, 1, {0, 0.001}},
+        {"x(x + 0.001)", [](double x){ return x*(x + 0.001); }, -1, 1, {-0.001, 0}},
+        {"x^3 - 1e-6x", [](double x){ return x*x*x - 1e-6*x; }, -1, 1, {-0.001, 0, 0.001}},
+        {"d - 1", [](double x){ return x - 1; }, 0, 2, {1}},
+        {"sen(20x)", [](double x){ return sin(20*x); }, -1, 1,
+            {-6*M_PI/20, -5*M_PI/20, -4*M_PI/20, -3*M_PI/20, -2*M_PI/20, -M_PI/20, 0,
+             M_PI/20, 2*M_PI/20, 3*M_PI/20, 4*M_PI/20, 5*M_PI/20, 6*M_PI/20}},
+        {"(x - 0.3)(x - 0.30001)", [](double x){ return (x - 0.3)*(x - 0.30001); }, -1, 1, {0.3, 0.30001}},
+        {"1.1d - d ln(d)", [](double x){ return 1.1*x - x*log(x); }, -1, 5, {exp(1.1)}},
+    };
+
+    int failures = 0;
+    for(const Case& c: cases){
+        vector<Result> found;
+        auto t0 = chrono::steady_clock::now();
+        for(int r = 0; r < repetitions; r++){
+            found = find_all_roots(c.f, c.lo, c.hi, pool, eps);
+        }
+        auto t1 = chrono::steady_clock::now();
+        double us = chrono::duration<double, micro>(t1 - t0).count() / repetitions;
+
+        bool ok = found.size() == c.roots.size();
+        double max_error = 0;
+        for(size_t i = 0; ok && i < found.size(); i++){
+            max_error = max(max_error, abs(found[i].root - c.roots[i]));
+            ok = max_error < 1e-8;
+        }
+        failures += !ok;
+        printf("  %-24s %3zu/%-3zu raízes %10.1f us %10.1e erro  %s\n", c.name, found.size(), c.roots.size(), us, max_error,
+            ok ? "ok" : "FALHOU");
+        if(!ok){
+            for(const Result& r: found){
+                printf("      %.12g\n", r.root);
+            }
+        }
+    }
+    return failures ? 1 : 0;
+}
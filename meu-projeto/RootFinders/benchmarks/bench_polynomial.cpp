@@ -0,0 +1,94 @@
+/*
+Benchmark dos polinômios de grau fixo (FixedPolynomial<N>, polynomial.hpp) contra a versão de grau dinâmico
+(Polynomial, com std::vector) para os graus 3 a 8: custo por avaliação de p e p' juntos e por resolução com
+Newton-Raphson. Também confere se as duas versões chegam à mesma raiz (a menos de 1e-12 relativo: a partir de
+FixedPolynomial::ESTRIN_MIN_DEGREE a ordem das operações muda e o arredondamento também).
+
+Compilação (a partir de RootFinders/):
+    cmake -S . -B build && cmake --build build --target bench_polynomial
+*/
+#include "../root_finders.hpp"
+#include "../generic_solvers.hpp"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace std;
+
+static volatile double sink;
+
+template <class Body>
+double ns_per_item(size_t items, int reps, Body&& body){
+    auto t0 = chrono::steady_clock::now();
+    for(int r = 0; r < reps; r++){
+        body();
+    }
+    auto t1 = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(t1 - t0).count() / (double(reps) * items);
+}
+
+// (x - 1)(x - 2)...(x - N) + 0.5, com uma raiz real perto de x = N
+template <int N>
+array<double, N + 1> coefficients(){
+    array<double, N + 1> c{};
+    c[0] = 1;
+    for(int r = 1; r <= N; r++){
+        for(int i = r; i > 0; i--){
+            c[i] -= r * c[i - 1];
+        }
+    }
+    c[N] += 0.5;
+    return c;
+}
+
+template <int N>
+void run(const vector<double>& xs){
+    const FixedPolynomial<N> fixed(coefficients<N>());
+    const Polynomial dynamic = fixed.dynamic();
+    const int reps = 2000;
+
+    double t_dynamic = ns_per_item(xs.size(), reps, [&]{
+        double acc = 0, p, dp;
+        for(double x: xs){
+            dynamic.eval(x, p, dp);
+            acc += p + dp;
+        }
+        sink = acc;
+    });
+    double t_fixed = ns_per_item(xs.size(), reps, [&]{
+        double acc = 0, p, dp;
+        for(double x: xs){
+            fixed.eval(x, p, dp);
+            acc += p + dp;
+        }
+        sink = acc;
+    });
+
+    const double x0 = N + 0.3;
+    const int solves = 200000;
+    Result r_dynamic{}, r_fixed{};
+    double t_newton_dynamic = ns_per_item(1, solves, [&]{ r_dynamic = polynomial_newton_raphson(dynamic, x0, 1e-10, 100); sink = r_dynamic.root; });
+    double t_newton_fixed = ns_per_item(1, solves, [&]{ r_fixed = generic::polynomial_newton_raphson(fixed, x0, 1e-10, 100); sink = r_fixed.root; });
+
+    bool same = abs(r_dynamic.root - r_fixed.root) <= 1e-12 * abs(r_dynamic.root);
+    printf("%5d %12.2f %12.2f %8.2fx %12.1f %12.1f %8.2fx %7d/%-4d %10s\n", N, t_dynamic, t_fixed, t_dynamic / t_fixed,
+           t_newton_dynamic, t_newton_fixed, t_newton_dynamic / t_newton_fixed, r_dynamic.interations, r_fixed.interations,
+           same ? "sim" : "nao");
+}
+
+int main(){
+    vector<double> xs(1024);
+    for(size_t i = 0; i < xs.size(); i++){
+        xs[i] = -1.0 + 10.0 * i / xs.size();
+    }
+
+    printf("%5s %12s %12s %9s %12s %12s %9s %12s %10s\n", "grau", "eval vector", "eval fixo", "ganho", "newton vec", "newton fixo", "ganho",
+           "interacoes", "mesma raiz");
+    run<3>(xs);
+    run<4>(xs);
+    run<5>(xs);
+    run<6>(xs);
+    run<7>(xs);
+    run<8>(xs);
+    return 0;
+}
@@ -0,0 +1,292 @@
+/*
+Suíte de benchmarks de todos os métodos de root_finders.hpp sobre um catálogo de funções de teste: funções suaves,
+raízes múltiplas, regiões planas e a família fa(a) do problema dos foguetes. Para cada par (função, método) mede o
+tempo por resolução (ns/solve), as avaliações de f e as interações por resolução e o erro atingido |raíz - raíz exata|.
+Os métodos de barramento só rodam nas funções com troca de sinal no barramento, e os métodos polinomiais só nas
+funções polinomiais.
+
+A saída é uma tabela em CSV (padrão) ou JSON, sempre na mesma ordem, com o commit em que o binário foi compilado, de
+modo que duas execuções podem ser comparadas linha a linha (por exemplo com diff ou numa planilha).
+
+Uso:
+    bench [--json] [--saida ARQUIVO] [--tempo MS] [--epsilon EPS] [--max-inter N] [--filtro TEXTO]
+
+    --tempo: tempo mínimo de medição de cada par, em milissegundos (padrão 20)
+    --filtro: só roda as funções ou métodos cujo nome contém TEXTO
+
+Compilação (a partir de RootFinders/):
+    cmake -S . -B build -DCMAKE_BUILD_TYPE=Release && cmake --build build --target bench
+*/
+#include "../root_finders.hpp"
+#include "../portfolio.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#ifndef RF_COMMIT
+#define RF_COMMIT "desconhecido"
+#endif
+
+using namespace std;
+
+// Função de teste, com o barramento, as aproximações iniciais e a raíz exata
+struct Case {
+    string name;
+    const char* category;
+    function<double(double)> f, df;
+    function<ad::Dual(ad::Dual)> f_dual;     // f em números duais (newton_raphson_ad)
+    function<ad::Dual2(ad::Dual2)> f_dual2;  // f em números duais de segunda ordem (halley)
+    double a, b;            // Barramento (a == b quando não há troca de sinal)
+    double x0, x1;          // Aproximações iniciais (x1 só é usada pelo método da secante)
+    double root;            // Raíz exata
+    vector<double> coeffs;  // Coeficientes, se f é polinomial (do maior para o menor grau)
+};
+
+struct Method {
+    const char* name;
+    bool needs_bracket;
+    bool needs_polynomial;
+    function<Result(const Case&, double, int)> solve;
+};
+
+struct Row {
+    const Case* c;
+    const Method* m;
+    double ns;
+    Result r;
+};
+
+// Descarta as mensagens que alguns métodos escrevem em cout (por exemplo a secante quando f(x1) = f(x0))
+struct NullBuffer : streambuf {
+    int overflow(int c) override { return c; }
+};
+
+static volatile double sink;
+
+vector<double> poly_from_roots(const vector<double>& roots){
+    vector<double> c{1.0};
+    for(double r: roots){
+        c.push_back(0.0);
+        for(size_t i = c.size() - 1; i > 0; i--){
+            c[i] -= r * c[i - 1];
+        }
+    }
+    return c;
+}
+
+// Caso a partir de f escrita de forma genérica (avaliada em double, ad::Dual e ad::Dual2) e de f' escrita à mão
+template <class G, class DG>
+Case make_case(string name, const char* category, G g, DG dg, double a, double b, double x0, double x1, double root,
+               vector<double> coeffs = {}){
+    return {name, category, g, dg, g, g, a, b, x0, x1, root, coeffs};
+}
+
+vector<Case> catalogue(){
+    vector<Case> cases;
+
+    // Funções suaves, com raízes simples
+    cases.push_back(make_case("cubica", "suave",
+        [](auto x){ return x*x*x - 2*x - 5; }, [](double x){ return 3*x*x - 2; },
+        2, 3, 2, 3, 2.0945514815423265, {1, 0, -2, -5}));
+    cases.push_back(make_case("cos", "suave",
+        [](auto x){ return cos(x) - x; }, [](double x){ return -sin(x) - 1; },
+        0, 1, 0.5, 1, 0.7390851332151607));
+    cases.push_back(make_case("exp", "suave",
+        [](auto x){ return exp(x) - 5; }, [](double x){ return exp(x); },
+        0, 3, 1, 3, log(5.0)));
+    vector<double> wilkinson = poly_from_roots({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+    auto p = make_shared<Polynomial>(wilkinson);
+    cases.push_back(make_case("wilkinson10", "suave",
+        [wilkinson](auto x){ decltype(x) y = 0; for(double c: wilkinson){ y = y*x + c; } return y; },
+        [p](double x){ return p->derivative(x); },
+        4.5, 5.5, 5.2, 5.3, 5, wilkinson));
+
+    // Raízes múltiplas: os métodos de convergência quadrática passam a convergir linearmente
+    cases.push_back(make_case("tripla", "multipla",
+        [](auto x){ return (x - 1)*(x - 1)*(x - 1); }, [](double x){ return 3*(x - 1)*(x - 1); },
+        0, 2.5, 2, 2.5, 1, {1, -3, 3, -1}));
+    cases.push_back(make_case("dupla", "multipla",
+        [](auto x){ return (x - 1)*(x - 1)*(x + 2); }, [](double x){ return 3*(x - 1)*(x + 1); },
+        0, 0, 2, 2.5, 1, {1, 0, -3, 2}));
+
+    // Regiões planas: f é quase nula perto da raíz (critérios de resíduo param cedo) ou longe dela (passos enormes)
+    cases.push_back(make_case("plana_exp", "plana",
+        [](auto x){ auto u = x - 1; return u == 0 ? u : u * exp(-1 / (u*u)); },
+        [](double x){ double u = x - 1; return u == 0 ? 0 : exp(-1 / (u*u)) * (1 + 2 / (u*u)); },
+        0.5, 2, 1.6, 1.8, 1));
+    cases.push_back(make_case("tanh", "plana",
+        [](auto x){ return tanh(x - 1); }, [](double x){ double t = tanh(x - 1); return 1 - t*t; },
+        -4, 50, 2.5, 3, 1));
+
+    // Família fa(a) = ad - dln(d) do problema dos foguetes, com o barramento e x0 de quadro_comparativo
+    for(double a: {-3.0, -1.0, 0.5, 1.5, 3.0}){
+        char name[32];
+        snprintf(name, sizeof name, "foguete_a=%g", a);
+        cases.push_back(make_case(name, "foguete",
+            [a](auto d){ return a*d - d*log(d); }, [a](double d){ return a - log(d) - 1; },
+            a < 0 ? pow(3.0, a) : pow(2.0, a), a < 0 ? pow(2.0, a) : pow(3.0, a),
+            pow(2.7, a), pow(2.72, a), exp(a)));
+    }
+    return cases;
+}
+
+// Função de interação por relaxação, phi(x) = x - f(x)/f'(x0), usada pelos métodos de ponto fixo
+function<double(double)> relaxation(const Case& c){
+    double slope = c.df(c.x0);
+    const auto& f = c.f;
+    return [&f, slope](double x){ return x - f(x) / slope; };
+}
+
+vector<Method> methods(){
+    return {
+        {"bisection", true, false, [](const Case& c, double eps, int max){ return bisection(c.f, c.a, c.b, eps, max); }},
+        {"false_position", true, false, [](const Case& c, double eps, int max){ return false_position(c.f, c.a, c.b, eps, max); }},
+        {"brent", true, false, [](const Case& c, double eps, int max){ return brent(c.f, c.a, c.b, eps, max); }},
+        {"illinois", true, false, [](const Case& c, double eps, int max){ return illinois(c.f, c.a, c.b, eps, max); }},
+        {"itp", true, false, [](const Case& c, double eps, int max){ return itp(c.f, c.a, c.b, eps, max); }},
+        {"fixed_point", false, false, [](const Case& c, double eps, int max){ return fixed_point(relaxation(c), c.x0, eps, max); }},
+        {"fixed_point_aitken", false, false, [](const Case& c, double eps, int max){ return fixed_point_aitken(relaxation(c), c.x0, eps, max); }},
+        {"steffensen", false, false, [](const Case& c, double eps, int max){ return steffensen(relaxation(c), c.x0, eps, max); }},
+        {"anderson", false, false, [](const Case& c, double eps, int max){ return anderson(relaxation(c), c.x0, eps, max); }},
+        {"newton_raphson", false, false, [](const Case& c, double eps, int max){ return newton_raphson(c.f, c.df, c.x0, eps, max); }},
+        {"newton_raphson_ad", false, false, [](const Case& c, double eps, int max){ return newton_raphson_ad(c.f_dual, c.x0, eps, max); }},
+        {"halley", false, false, [](const Case& c, double eps, int max){ return halley(c.f_dual2, c.x0, eps, max); }},
+        {"secant", false, false, [](const Case& c, double eps, int max){ return secant(c.f, c.x0, c.x1, eps, max); }},
+        {"portfolio", false, false, [](const Case& c, double eps, int max){ return portfolio::solve(c.f, c.df, c.a, c.b, c.x0, eps, max).result; }},
+        {"polynomial_newton_raphson", false, true, [](const Case& c, double eps, int max){
+            return polynomial_newton_raphson(c.coeffs, c.x0, eps, max);
+        }},
+        {"polynomial_all_roots", false, true, [](const Case& c, double eps, int max){
+            // Reportada como a raíz calculada mais próxima da raíz exata do caso
+            AllRootsResult all = polynomial_all_roots(Polynomial(c.coeffs), eps, max);
+            Result r{NAN, all.interations, all.converged, all.residual, all.error, all.function_evaluations};
+            for(const complex<double>& z: all.roots){
+                if(!(abs(z - c.root) >= abs(r.root - c.root))){
+                    r.root = z.real();
+                }
+            }
+            return r;
+        }},
+    };
+}
+
+// Resolve o caso repetidamente até completar min_ns nanossegundos e retorna o tempo médio por resolução
+double ns_per_solve(const Case& c, const Method& m, double eps, int max_inter, double min_ns, Result& r){
+    r = m.solve(c, eps, max_inter);
+    long reps = 1;
+    while(true){
+        double acc = 0;
+        auto t0 = chrono::steady_clock::now();
+        for(long i = 0; i < reps; i++){
+            acc += m.solve(c, eps, max_inter).root;
+        }
+        double elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count();
+        sink = acc;
+        if(elapsed >= min_ns || reps >= (1L << 30)){
+            return elapsed / reps;
+        }
+        reps = elapsed > 0 ? max(2 * reps, (long)(reps * 1.2 * min_ns / elapsed)) : 2 * reps;
+    }
+}
+
+// Números não finitos não existem em JSON
+string number(double x){
+    if(!isfinite(x)){
+        return "null";
+    }
+    char buf[32];
+    snprintf(buf, sizeof buf, "%.6g", x);
+    return buf;
+}
+
+void write_csv(FILE* out, const vector<Row>& rows){
+    fprintf(out, "# commit %s\n", RF_COMMIT);
+    fprintf(out, "function,category,method,ns_per_solve,function_evaluations,interations,converged,abs_error,residual\n");
+    for(const Row& row: rows){
+        fprintf(out, "%s,%s,%s,%.1f,%d,%d,%d,%.3e,%.3e\n", row.c->name.c_str(), row.c->category, row.m->name, row.ns,
+                row.r.function_evaluations, row.r.interations, (int)row.r.converged, abs(row.r.root - row.c->root), row.r.residual);
+    }
+}
+
+void write_json(FILE* out, const vector<Row>& rows, double eps, int max){
+    fprintf(out, "{\n  \"commit\": \"%s\",\n  \"epsilon\": %s,\n  \"max_inter\": %d,\n  \"results\": [\n", RF_COMMIT, number(eps).c_str(), max);
+    for(size_t i = 0; i < rows.size(); i++){
+        const Row& row = rows[i];
+        fprintf(out, "    {\"function\": \"%s\", \"category\": \"%s\", \"method\": \"%s\", \"ns_per_solve\": %s, "
+                     "\"function_evaluations\": %d, \"interations\": %d, \"converged\": %s, \"abs_error\": %s, \"residual\": %s}%s\n",
+                row.c->name.c_str(), row.c->category, row.m->name, number(row.ns).c_str(), row.r.function_evaluations,
+                row.r.interations, row.r.converged ? "true" : "false", number(abs(row.r.root - row.c->root)).c_str(),
+                number(row.r.residual).c_str(), i + 1 < rows.size() ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+}
+
+int main(int argc, char** argv){
+    bool json = false;
+    const char* path = nullptr;
+    const char* filter = nullptr;
+    double min_ms = 20;
+    double eps = 1e-10;
+    int max_inter = 200;
+    for(int i = 1; i < argc; i++){
+        if(strcmp(argv[i], "--json") == 0){
+            json = true;
+        }else if(strcmp(argv[i], "--saida") == 0 && i + 1 < argc){
+            path = argv[++i];
+        }else if(strcmp(argv[i], "--tempo") == 0 && i + 1 < argc){
+            min_ms = atof(argv[++i]);
+        }else if(strcmp(argv[i], "--epsilon") == 0 && i + 1 < argc){
+            eps = atof(argv[++i]);
+        }else if(strcmp(argv[i], "--max-inter") == 0 && i + 1 < argc){
+            max_inter = atoi(argv[++i]);
+        }else if(strcmp(argv[i], "--filtro") == 0 && i + 1 < argc){
+            filter = argv[++i];
+        }else{
+            fprintf(stderr, "Uso: %s [--json] [--saida ARQUIVO] [--tempo MS] [--epsilon EPS] [--max-inter N] [--filtro TEXTO]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    vector<Case> cases = catalogue();
+    vector<Method> all_methods = methods();
+    vector<Row> rows;
+    NullBuffer null_buffer;
+    streambuf* cout_buffer = cout.rdbuf(&null_buffer);
+    for(const Case& c: cases){
+        bool has_bracket = c.a != c.b;
+        for(const Method& m: all_methods){
+            if((m.needs_bracket && !has_bracket) || (m.needs_polynomial && c.coeffs.empty())){
+                continue;
+            }
+            if(filter && c.name.find(filter) == string::npos && strstr(m.name, filter) == nullptr){
+                continue;
+            }
+            Row row{&c, &m, 0, {}};
+            row.ns = ns_per_solve(c, m, eps, max_inter, min_ms * 1e6, row.r);
+            rows.push_back(row);
+        }
+    }
+    cout.rdbuf(cout_buffer);
+
+    FILE* out = path ? fopen(path, "w") : stdout;
+    if(!out){
+        fprintf(stderr, "Não foi possível abrir %s\n", path);
+        return 1;
+    }
+    if(json){
+        write_json(out, rows, eps, max_inter);
+    }else{
+        write_csv(out, rows);
+    }
+    if(path){
+        fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+Benchmark dos métodos para sistemas (systems.hpp) numa cadeia de N foguetes acoplados,
+
+    Fi(d) = ai*di - di*ln(di) + gamma*(d(i-1) - 2di + d(i+1)),
+
+com ai em [-1, 2] e d0 = d(N+1) = 0, para N = 2, 4, 8 e 16: tempo por resolução, interações, avaliações de F e
+jacobianas de newton (jacobiana escrita à mão), newton_ad (jacobiana por diferenciação automática) e broyden
+(jacobiana inicial por diferenças finitas). Também confere se os três chegam à mesma raíz (a menos de 1e-8).
+
+Compilação (a partir de RootFinders/):
+    cmake -S . -B build && cmake --build build --target bench_systems
+*/
+#include "../systems.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+using namespace std;
+
+static volatile double sink;
+
+template <class Body>
+double ns_per_item(size_t items, int reps, Body&& body){
+    auto t0 = chrono::steady_clock::now();
+    for(int r = 0; r < reps; r++){
+        body();
+    }
+    auto t1 = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(t1 - t0).count() / (double(reps) * items);
+}
+
+template <int N>
+struct Chain {
+    double a[N];
+    double gamma = 0.05;
+
+    template <class T>
+    nd::Vector<N, T> operator()(const nd::Vector<N, T>& d) const {
+        using std::log;
+        nd::Vector<N, T> y;
+        for(int i = 0; i < N; i++){
+            T coupling = d[i] * -2.0;
+            if(i > 0){
+                coupling += d[i - 1];
+            }
+            if(i + 1 < N){
+                coupling += d[i + 1];
+            }
+            y[i] = a[i]*d[i] - d[i]*log(d[i]) + gamma*coupling;
+        }
+        return y;
+    }
+
+    nd::Matrix<N> jacobian(const nd::Vector<N>& d) const {
+        nd::Matrix<N> J{};
+        for(int i = 0; i < N; i++){
+            J(i, i) = a[i] - log(d[i]) - 1 - 2*gamma;
+            if(i > 0){
+                J(i, i - 1) = gamma;
+            }
+            if(i + 1 < N){
+                J(i, i + 1) = gamma;
+            }
+        }
+        return J;
+    }
+};
+
+template <int N>
+void run(){
+    Chain<N> f;
+    nd::Vector<N> x0;
+    for(int i = 0; i < N; i++){
+        f.a[i] = N == 1 ? 0.5 : -1.0 + 3.0 * i / (N - 1);
+        x0[i] = pow(2.7, f.a[i]);
+    }
+    auto jacobian = [&f](const nd::Vector<N>& d){ return f.jacobian(d); };
+    const double epsilon = 1e-12;
+    const int solves = 200000 / N;
+
+    nd::SystemResult<N> r[3];
+    double t[3] = {
+        ns_per_item(1, solves, [&]{ r[0] = nd::newton(f, jacobian, x0, epsilon); sink = r[0].root[0]; }),
+        ns_per_item(1, solves, [&]{ r[1] = nd::newton_ad(f, x0, epsilon); sink = r[1].root[0]; }),
+        ns_per_item(1, solves, [&]{ r[2] = nd::broyden(f, x0, epsilon); sink = r[2].root[0]; }),
+    };
+    const char* names[3] = {"newton", "newton_ad", "broyden"};
+    for(int m = 0; m < 3; m++){
+        double diff = 0;
+        for(int i = 0; i < N; i++){
+            diff = fmax(diff, abs(r[m].root[i] - r[0].root[i]) / fmax(1.0, abs(r[0].root[i])));
+        }
+        printf("%3d %-10s %12.1f %11d %9d %10d %12.3e %10s %10s\n", N, names[m], t[m], r[m].interations,
+               r[m].function_evaluations, r[m].jacobian_evaluations, r[m].residual, r[m].converged ? "sim" : "nao",
+               diff <= 1e-8 ? "sim" : "nao");
+    }
+}
+
+int main(){
+    printf("%3s %-10s %12s %11s %9s %10s %12s %10s %10s\n", "N", "metodo", "ns/solve", "interacoes", "aval. F",
+           "jacobianas", "|F(x)|", "convergiu", "mesma raiz");
+    run<2>();
+    run<4>();
+    run<8>();
+    run<16>();
+    return 0;
+}
@@ -0,0 +1,228 @@
+#ifndef CONTINUATION_HPP
+#define CONTINUATION_HPP
+
+#include "root_finders.hpp"
+#include "generic_solvers.hpp"
+#include "batch_solvers.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+/*
+Varreduras por continuação para grades densas de um parâmetro p de uma família f(p, x) (por exemplo RocketFamily,
+onde p = a). Os parâmetros são percorridos em ordem crescente e cada resolução parte da raíz do parâmetro anterior,
+corrigida por um passo preditor de primeira ordem:
+
+    x_pred = x_ant + (dx/dp)*(p - p_ant),   dx/dp = -(df/dp)/(df/dx) avaliadas em (p_ant, x_ant)
+
+Em grades finas o erro do preditor é O((p - p_ant)^2), e o método converge em uma ou duas interações. Quando o preditor
+falha (o método não converge a partir dele, ou a raíz anterior não convergiu), o ponto é resolvido do zero a partir
+da aproximação inicial fria fornecida pelo usuário, e o número desses recomeços é retornado.
+
+A família deve fornecer f(p, x), df(p, x) (derivada em x) e dfda(p, x) (derivada em p) para V = double. Os resultados
+saem em um BatchResult na ordem original dos parâmetros, e as interações e avaliações de f de cada ponto incluem as da
+tentativa que falhou, quando houver.
+*/
+
+namespace continuation_detail {
+
+// Índices de params em ordem crescente de parâmetro
+inline std::vector<std::size_t> sorted_order(const double* params, std::size_t n){
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    if(std::is_sorted(params, params + n)){
+        return order;
+    }
+    std::stable_sort(order.begin(), order.end(), [params](std::size_t i, std::size_t j){ return params[i] < params[j]; });
+    return order;
+}
+
+inline void store(BatchResult& out, std::size_t i, const Result& r){
+    out.root[i] = r.root;
+    out.residual[i] = r.residual;
+    out.error[i] = r.error;
+    out.converged[i] = r.converged && std::isfinite(r.root);
+    out.interations[i] = r.interations;
+    out.function_evaluations[i] = r.function_evaluations;
+    out.interations_float[i] = 0;
+}
+
+// Estado compartilhado pelas varreduras: a última raíz convergida e a derivada dx/dp nela
+template <class Family>
+struct Predictor {
+    const Family& family;
+    bool valid = false;
+    double p_prev = 0, x_prev = 0, slope = 0;
+    double last_error = -1;  // |raíz - x_pred| do último ponto previsto (-1 se ainda não houve)
+    double last_step = 0;    // p - p_ant do último ponto previsto
+
+    explicit Predictor(const Family& f) : family(f) {}
+
+    // Previsão para o parâmetro p (custa 2 avaliações: df e dfda no ponto anterior, já contadas em update)
+    double predict(double p) const {
+        return x_prev + slope * (p - p_prev);
+    }
+
+    // Estimativa do erro da previsão para p, escalando o erro do último ponto por ((p - p_ant)/último passo)^2
+    double error_estimate(double p) const {
+        double step = p - p_prev;
+        if(last_error < 0 || last_step == 0){
+            return std::abs(slope * step);
+        }
+        return last_error * (step / last_step) * (step / last_step);
+    }
+
+    // Registra a raíz de p; retorna o número de avaliações usadas para calcular dx/dp
+    int update(double p, const Result& r, bool predicted, double x_pred){
+        valid = r.converged && std::isfinite(r.root);
+        if(!valid){
+            last_error = -1;
+            return 0;
+        }
+        if(predicted){
+            last_error = std::abs(r.root - x_pred);
+            last_step = p - p_prev;
+        }else{
+            last_error = -1;
+        }
+        p_prev = p;
+        x_prev = r.root;
+        slope = -family.dfda(p, x_prev) / family.df(p, x_prev);
+        if(!std::isfinite(slope)){
+            slope = 0;
+        }
+        return 2;
+    }
+};
+
+} // namespace continuation_detail
+
+// Varredura com Newton-Raphson
+template <class Family, class ColdStart>
+int sweep_newton_raphson(const Family& family, const double* params, std::size_t n, const ColdStart& cold_x0,
+                         double epsilon, int max_inter, BatchResult& out, std::vector<double>* seeds=nullptr){
+/*
+Resolve f(params[i], x) = 0 para cada i em [0, n) com Newton-Raphson, partindo da raíz prevista a partir do parâmetro
+anterior (na ordem crescente de params). Se Newton não converge em até warm_inter = min(max_inter, 10) interações a
+partir da previsão, o ponto é resolvido novamente a partir de cold_x0(params[i]).
+    Args:
+        (Family) family: Família de funções f(p, x), com derivadas df(p, x) e dfda(p, x)
+        (const double*) params: Vetor de tamanho n com os parâmetros, em qualquer ordem
+        (ColdStart) cold_x0: Aproximação inicial fria, chamada como cold_x0(p)
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (BatchResult&) out: Resultados, redimensionado para n posições
+        (vector<double>*) seeds: Se fornecido, recebe a aproximação inicial usada em cada posição
+
+    Returns:
+        (int): Quantidade de pontos resolvidos a partir da aproximação fria (recomeços)
+*/
+    out.resize(n);
+    if(seeds){
+        seeds->assign(n, 0);
+    }
+    const int warm_inter = std::min(max_inter, 10);
+    continuation_detail::Predictor<Family> predictor(family);
+    int cold_starts = 0;
+    for(std::size_t i: continuation_detail::sorted_order(params, n)){
+        double p = params[i];
+        auto f = [&family, p](double x){ return family.f(p, x); };
+        auto df = [&family, p](double x){ return family.df(p, x); };
+
+        bool predicted = predictor.valid;
+        double x0 = predicted ? predictor.predict(p) : cold_x0(p);
+        Result r = generic::newton_raphson(f, df, x0, epsilon, predicted ? warm_inter : max_inter);
+        if(predicted && !(r.converged && std::isfinite(r.root))){
+            // O preditor falhou: recomeça do zero, somando o esforço das duas tentativas
+            Result cold = generic::newton_raphson(f, df, x0 = cold_x0(p), epsilon, max_inter);
+            cold.interations += r.interations;
+            cold.function_evaluations += r.function_evaluations;
+            r = cold;
+            predicted = false;
+            cold_starts++;
+        }else if(!predicted){
+            cold_starts++;
+        }
+        r.function_evaluations += predictor.update(p, r, predicted, x0);
+        continuation_detail::store(out, i, r);
+        if(seeds){
+            (*seeds)[i] = x0;
+        }
+    }
+    return cold_starts;
+}
+
+// Varredura com o método de Brent
+template <class Family, class ColdBracket>
+int sweep_brent(const Family& family, const double* params, std::size_t n, const ColdBracket& cold_bracket,
+                double epsilon, int max_inter, BatchResult& out, std::vector<Bracket>* brackets=nullptr){
+/*
+Resolve f(params[i], x) = 0 para cada i em [0, n) com o método de Brent, usando como barramento um intervalo estreito
+[x_pred - r, x_pred + r] em torno da raíz prevista, com r igual ao dobro do erro estimado da previsão (no mínimo
+epsilon/2, quando o próprio barramento já satisfaz o critério de parada e Brent não precisa avaliar f). Se não há
+troca de sinal nesse intervalo, r é multiplicado por 4 (até 4 vezes); se ainda assim não há, o ponto é resolvido a
+partir do barramento frio cold_bracket(params[i], lo, hi).
+    Args:
+        (Family) family: Família de funções f(p, x), com derivadas df(p, x) e dfda(p, x)
+        (const double*) params: Vetor de tamanho n com os parâmetros, em qualquer ordem
+        (ColdBracket) cold_bracket: Barramento frio, chamado como cold_bracket(p, lo, hi) e escrevendo em lo e hi
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (BatchResult&) out: Resultados, redimensionado para n posições. Barramentos inválidos retornam root = NaN
+        (vector<Bracket>*) brackets: Se fornecido, recebe o barramento usado em cada posição
+
+    Returns:
+        (int): Quantidade de pontos resolvidos a partir do barramento frio (recomeços)
+*/
+    out.resize(n);
+    if(brackets){
+        brackets->assign(n, Bracket{0, 0, 0, 0});
+    }
+    continuation_detail::Predictor<Family> predictor(family);
+    int cold_starts = 0;
+    for(std::size_t i: continuation_detail::sorted_order(params, n)){
+        double p = params[i];
+        auto f = [&family, p](double x){ return family.f(p, x); };
+
+        int probes = 0;
+        bool predicted = false;
+        double x_pred = 0;
+        Bracket bracket{0, 0, 0, 0};
+        if(predictor.valid){
+            x_pred = predictor.predict(p);
+            double r = std::max(2 * predictor.error_estimate(p), 0.5 * epsilon);
+            for(int expansion = 0; expansion <= 4 && !predicted; expansion++, r *= 4){
+                bracket = {x_pred - r, x_pred + r, f(x_pred - r), f(x_pred + r)};
+                probes += 2;
+                predicted = bracket.fa * bracket.fb < 0;
+            }
+        }
+        if(!predicted){
+            cold_bracket(p, bracket.a, bracket.b);
+            bracket.fa = f(bracket.a);
+            bracket.fb = f(bracket.b);
+            probes += 2;
+            cold_starts++;
+        }
+
+        Result r;
+        if(bracket.fa * bracket.fb < 0){
+            // Os valores de f nos extremos já foram calculados e contados em probes (Brent também os conta)
+            r = generic::brent(f, bracket, epsilon, max_inter);
+            r.function_evaluations -= 2;
+        }else{
+            r = {NAN, 0, false, NAN, NAN, 0};
+        }
+        r.function_evaluations += probes;
+        r.function_evaluations += predictor.update(p, r, predicted, x_pred);
+        continuation_detail::store(out, i, r);
+        if(brackets){
+            (*brackets)[i] = bracket;
+        }
+    }
+    return cold_starts;
+}
+
+#endif
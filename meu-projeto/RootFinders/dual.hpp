@@ -0,0 +1,115 @@
+#ifndef DUAL_HPP
+#define DUAL_HPP
+
+#include <cmath>
+
+/*
+Diferenciação automática no modo direto. Uma função escrita de forma genérica, como
+
+    auto f = [a](auto d){ return a*d - d*log(d); };
+
+quando chamada com ad::Dual{x, 1} devolve f(x) em .v e f'(x) em .d numa única avaliação (subexpressões como log(d)
+são calculadas uma vez para o valor e a derivada), e chamada com ad::Dual2{x, 1, 0} devolve também f''(x) em .d2.
+Assim os métodos de Newton (newton_raphson_ad) e de Halley (halley) dispensam a derivada escrita à mão.
+
+As funções matemáticas (log, exp, sin, pow, ...) são encontradas por ADL quando chamadas sem qualificação; chamadas
+qualificadas como std::log(d) não aceitam números duais. As comparações usam apenas o valor.
+*/
+namespace ad {
+
+// Número dual v + d*eps (eps^2 = 0): valor e primeira derivada
+struct Dual {
+    double v, d;
+
+    constexpr Dual(double value = 0, double derivative = 0) : v(value), d(derivative) {}
+
+    Dual& operator+=(const Dual& o){ v += o.v; d += o.d; return *this; }
+    Dual& operator-=(const Dual& o){ v -= o.v; d -= o.d; return *this; }
+    Dual& operator*=(const Dual& o){ d = d*o.v + v*o.d; v *= o.v; return *this; }
+    Dual& operator/=(const Dual& o){ v /= o.v; d = (d - v*o.d) / o.v; return *this; }
+};
+
+// Valor, primeira e segunda derivadas
+struct Dual2 {
+    double v, d, d2;
+
+    constexpr Dual2(double value = 0, double derivative = 0, double second = 0) : v(value), d(derivative), d2(second) {}
+
+    Dual2& operator+=(const Dual2& o){ v += o.v; d += o.d; d2 += o.d2; return *this; }
+    Dual2& operator-=(const Dual2& o){ v -= o.v; d -= o.d; d2 -= o.d2; return *this; }
+    Dual2& operator*=(const Dual2& o){
+        d2 = d2*o.v + 2*d*o.d + v*o.d2;
+        d = d*o.v + v*o.d;
+        v *= o.v;
+        return *this;
+    }
+    Dual2& operator/=(const Dual2& o){
+        // q = u/w, q' = (u' - q w')/w, q'' = (u'' - 2q'w' - q w'')/w
+        v /= o.v;
+        d = (d - v*o.d) / o.v;
+        d2 = (d2 - 2*d*o.d - v*o.d2) / o.v;
+        return *this;
+    }
+};
+
+// Regra da cadeia para g(u), dados g(u), g'(u) e (no Dual2) g''(u)
+inline Dual chain(const Dual& u, double g, double g1, double = 0){
+    return {g, g1*u.d};
+}
+inline Dual2 chain(const Dual2& u, double g, double g1, double g2){
+    return {g, g1*u.d, g2*u.d*u.d + g1*u.d2};
+}
+
+// Operadores e funções comuns aos dois tipos
+#define AD_DEFINE_OPERATIONS(T) \
+    inline T operator+(T a, const T& b){ return a += b; } \
+    inline T operator-(T a, const T& b){ return a -= b; } \
+    inline T operator*(T a, const T& b){ return a *= b; } \
+    inline T operator/(T a, const T& b){ return a /= b; } \
+    inline T operator+(T a, double b){ a.v += b; return a; } \
+    inline T operator+(double a, T b){ b.v += a; return b; } \
+    inline T operator-(T a, double b){ a.v -= b; return a; } \
+    inline T operator-(double a, const T& b){ return T(a) - b; } \
+    inline T operator*(const T& a, double b){ return chain(a, a.v*b, b, 0); } \
+    inline T operator*(double a, const T& b){ return chain(b, a*b.v, a, 0); } \
+    inline T operator/(const T& a, double b){ return chain(a, a.v/b, 1/b, 0); } \
+    inline T operator/(double a, const T& b){ return chain(b, a/b.v, -a/(b.v*b.v), 2*a/(b.v*b.v*b.v)); } \
+    inline T operator-(const T& a){ return chain(a, -a.v, -1, 0); } \
+    inline T operator+(const T& a){ return a; } \
+    inline bool operator<(const T& a, const T& b){ return a.v < b.v; } \
+    inline bool operator>(const T& a, const T& b){ return a.v > b.v; } \
+    inline bool operator<=(const T& a, const T& b){ return a.v <= b.v; } \
+    inline bool operator>=(const T& a, const T& b){ return a.v >= b.v; } \
+    inline bool operator==(const T& a, const T& b){ return a.v == b.v; } \
+    inline bool operator!=(const T& a, const T& b){ return a.v != b.v; } \
+    inline T exp(const T& u){ double e = std::exp(u.v); return chain(u, e, e, e); } \
+    inline T log(const T& u){ return chain(u, std::log(u.v), 1/u.v, -1/(u.v*u.v)); } \
+    inline T log10(const T& u){ const double k = 1/std::log(10.0); return chain(u, std::log10(u.v), k/u.v, -k/(u.v*u.v)); } \
+    inline T sqrt(const T& u){ double s = std::sqrt(u.v); return chain(u, s, 0.5/s, -0.25/(s*u.v)); } \
+    inline T sin(const T& u){ double s = std::sin(u.v), c = std::cos(u.v); return chain(u, s, c, -s); } \
+    inline T cos(const T& u){ double s = std::sin(u.v), c = std::cos(u.v); return chain(u, c, -s, -c); } \
+    inline T tan(const T& u){ double t = std::tan(u.v), s = 1 + t*t; return chain(u, t, s, 2*t*s); } \
+    inline T asin(const T& u){ double r = 1 / std::sqrt(1 - u.v*u.v); return chain(u, std::asin(u.v), r, u.v*r*r*r); } \
+    inline T acos(const T& u){ double r = 1 / std::sqrt(1 - u.v*u.v); return chain(u, std::acos(u.v), -r, -u.v*r*r*r); } \
+    inline T atan(const T& u){ double r = 1 / (1 + u.v*u.v); return chain(u, std::atan(u.v), r, -2*u.v*r*r); } \
+    inline T sinh(const T& u){ double s = std::sinh(u.v), c = std::cosh(u.v); return chain(u, s, c, s); } \
+    inline T cosh(const T& u){ double s = std::sinh(u.v), c = std::cosh(u.v); return chain(u, c, s, c); } \
+    inline T tanh(const T& u){ double t = std::tanh(u.v), s = 1 - t*t; return chain(u, t, s, -2*t*s); } \
+    inline T abs(const T& u){ double s = (u.v > 0) - (u.v < 0); return chain(u, std::abs(u.v), s, 0); } \
+    inline T pow(const T& u, double k){ \
+        if(k == 0) return T(1); \
+        if(k == 1) return u; \
+        if(k == 2) return u*u; \
+        return chain(u, std::pow(u.v, k), k*std::pow(u.v, k - 1), k*(k - 1)*std::pow(u.v, k - 2)); \
+    } \
+    inline T pow(const T& u, const T& w){ return exp(w * log(u)); } \
+    inline T pow(double b, const T& w){ return exp(w * std::log(b)); }
+
+AD_DEFINE_OPERATIONS(Dual)
+AD_DEFINE_OPERATIONS(Dual2)
+
+#undef AD_DEFINE_OPERATIONS
+
+} // namespace ad
+
+#endif
@@ -0,0 +1,572 @@
+#ifndef EXPRESSION_HPP
+#define EXPRESSION_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/*
+Expressões f(x) fornecidas em tempo de execução, como "a*x - x*log(x)", compiladas para um programa de registradores
+que pode ser passado diretamente a qualquer método de root_finders.hpp (Expression é chamável como double(double)) e
+às versões templatizadas de generic_solvers.hpp.
+
+Gramática (precedência crescente; ^ e ** associam à direita e -x^2 = -(x^2)):
+    expr    := termo (('+' | '-') termo)*
+    termo   := unario (('*' | '/') unario)*
+    unario  := ('+' | '-') unario | potencia
+    potencia:= primario (('^' | '**') unario)?
+    primario:= número | nome | função '(' expr ')' | 'pow(' expr ',' expr ')' | '(' expr ')'
+Funções: sin cos tan asin acos atan sinh cosh tanh exp log (natural) log10 sqrt abs sign. Constantes: pi, e e as
+fornecidas na construção (por exemplo {"a", 2.0}), que são substituídas pelo seu valor durante a compilação.
+
+Compilação: a árvore de sintaxe é construída como um grafo em que cada subexpressão aparece uma única vez (subexpressões
+comuns, como log(x) em "x*log(x) + log(x)", são avaliadas uma única vez), subexpressões constantes são calculadas na
+compilação e identidades triviais (x + 0, x*1, x^1, --x, ...) são eliminadas. Os nós, em ordem topológica, formam o
+programa: a instrução i escreve o registrador i a partir de registradores anteriores, sem pilha nem recursão.
+
+derivative() deriva o programa simbolicamente (com as mesmas simplificações), o que dá f'(x) para Newton-Raphson e
+polynomial_newton_raphson sem que o usuário precise escrevê-la. A avaliação em lote (eval com vetores) executa cada
+instrução sobre blocos de BATCH valores de x de uma vez, diluindo o custo de interpretação entre eles.
+*/
+class Expression {
+public:
+    static constexpr std::size_t BATCH = 64;
+
+    enum class Op : std::uint8_t {
+        Const, Var,
+        Add, Sub, Mul, Div, Pow,
+        Neg, Sin, Cos, Tan, Asin, Acos, Atan, Sinh, Cosh, Tanh, Exp, Log, Log10, Sqrt, Abs, Sign
+    };
+
+    // Instrução: registrador[i] = op(registrador[a], registrador[b]) (value guarda a constante de Const)
+    struct Instruction {
+        Op op;
+        int a, b;
+        double value;
+    };
+
+    explicit Expression(const std::string& source, std::vector<std::string> variables = {"x"},
+                        const std::map<std::string, double>& constants = {});
+
+    // f(x), para expressões de uma variável
+    double operator()(double x) const;
+
+    // f(values[0], values[1], ...), na ordem das variáveis da construção
+    double eval(const double* values) const;
+
+    // out[i] = f(x[i]) para i em [0, n), para expressões de uma variável
+    void eval(const double* x, double* out, std::size_t n) const;
+
+    // Derivada em relação à variável dada (a primeira, se vazia)
+    Expression derivative(const std::string& variable = "") const;
+
+    const std::string& source() const { return source_; }
+    const std::vector<std::string>& variables() const { return variables_; }
+    const std::vector<Instruction>& program() const { return program_; }
+
+private:
+    std::string source_;
+    std::vector<std::string> variables_;
+    std::vector<Instruction> program_;  // Em ordem topológica; o resultado é o último registrador
+    std::size_t first_op_ = 0;          // Índice da primeira instrução que não é Const nem Var
+
+    void set_program(std::vector<Instruction> program){
+        program_ = std::move(program);
+        first_op_ = 0;
+        while(first_op_ < program_.size() && (program_[first_op_].op == Op::Const || program_[first_op_].op == Op::Var)){
+            first_op_++;
+        }
+    }
+
+    Expression() = default;
+
+    class Builder;
+    class Parser;
+
+    static double apply(Op op, double x, double y){
+        switch(op){
+            case Op::Add: return x + y;
+            case Op::Sub: return x - y;
+            case Op::Mul: return x * y;
+            case Op::Div: return x / y;
+            case Op::Pow: return std::pow(x, y);
+            case Op::Neg: return -x;
+            case Op::Sin: return std::sin(x);
+            case Op::Cos: return std::cos(x);
+            case Op::Tan: return std::tan(x);
+            case Op::Asin: return std::asin(x);
+            case Op::Acos: return std::acos(x);
+            case Op::Atan: return std::atan(x);
+            case Op::Sinh: return std::sinh(x);
+            case Op::Cosh: return std::cosh(x);
+            case Op::Tanh: return std::tanh(x);
+            case Op::Exp: return std::exp(x);
+            case Op::Log: return std::log(x);
+            case Op::Log10: return std::log10(x);
+            case Op::Sqrt: return std::sqrt(x);
+            case Op::Abs: return std::abs(x);
+            case Op::Sign: return (x > 0) - (x < 0);
+            default: return NAN;
+        }
+    }
+
+    static bool is_binary(Op op){
+        return op == Op::Add || op == Op::Sub || op == Op::Mul || op == Op::Div || op == Op::Pow;
+    }
+};
+
+// Monta o grafo de instruções, reaproveitando nós iguais e simplificando na inserção
+class Expression::Builder {
+public:
+    std::vector<Instruction> nodes;
+
+    Builder() = default;
+    explicit Builder(const std::vector<Instruction>& program){
+        for(const Instruction& ins: program){
+            intern(ins);
+        }
+    }
+
+    int constant(double v){ return intern({Op::Const, -1, -1, v}); }
+    int variable(int index){ return intern({Op::Var, index, -1, 0}); }
+
+    bool is_const(int i, double v) const { return nodes[i].op == Op::Const && nodes[i].value == v; }
+    bool is_const(int i) const { return nodes[i].op == Op::Const; }
+
+    int unary(Op op, int a){
+        if(is_const(a)){
+            return constant(apply(op, nodes[a].value, 0));
+        }
+        if(op == Op::Neg && nodes[a].op == Op::Neg){
+            return nodes[a].a;
+        }
+        return intern({op, a, -1, 0});
+    }
+
+    int binary(Op op, int a, int b){
+        if(is_const(a) && is_const(b)){
+            return constant(apply(op, nodes[a].value, nodes[b].value));
+        }
+        int exponent;
+        switch(op){
+            case Op::Add:
+                if(is_const(a, 0)) return b;
+                if(is_const(b, 0)) return a;
+                if(nodes[b].op == Op::Neg) return binary(Op::Sub, a, nodes[b].a);
+                break;
+            case Op::Sub:
+                if(is_const(b, 0)) return a;
+                if(a == b) return constant(0);
+                if(nodes[b].op == Op::Neg) return binary(Op::Add, a, nodes[b].a);
+                break;
+            case Op::Mul:
+                if(is_const(a, 0) || is_const(b, 0)) return constant(0);
+                if(is_const(a, 1)) return b;
+                if(is_const(b, 1)) return a;
+                if(is_const(a, -1)) return unary(Op::Neg, b);
+                if(is_const(b, -1)) return unary(Op::Neg, a);
+                break;
+            case Op::Div:
+                if(is_const(a, 0)) return constant(0);
+                if(is_const(b, 1)) return a;
+                // Divisão por potência de 2 vira multiplicação (o inverso é exato, então o resultado não muda)
+                if(is_const(b) && std::abs(std::frexp(nodes[b].value, &exponent)) == 0.5){
+                    return binary(Op::Mul, a, constant(1 / nodes[b].value));
+                }
+                break;
+            case Op::Pow:
+                if(is_const(b, 0)) return constant(1);
+                if(is_const(b, 1)) return a;
+                if(is_const(b, 2)) return binary(Op::Mul, a, a);
+                if(is_const(b, 0.5)) return unary(Op::Sqrt, a);
+                if(is_const(b, -1)) return binary(Op::Div, constant(1), a);
+                break;
+            default:
+                break;
+        }
+        // Operações comutativas em forma canônica, para que x*y e y*x sejam o mesmo nó
+        if((op == Op::Add || op == Op::Mul) && a > b){
+            std::swap(a, b);
+        }
+        return intern({op, a, b, 0});
+    }
+
+    // Cópia do subgrafo alcançável a partir de root, renumerado em ordem topológica com as constantes primeiro, depois
+    // as variáveis e por fim as operações (o laço de avaliação só passa pelas operações)
+    std::vector<Instruction> extract(int root) const {
+        std::vector<char> live(nodes.size(), 0);
+        live[root] = 1;
+        for(int i = root; i >= 0; i--){
+            if(!live[i]) continue;
+            if(nodes[i].op != Op::Const && nodes[i].op != Op::Var){
+                live[nodes[i].a] = 1;
+                if(is_binary(nodes[i].op)) live[nodes[i].b] = 1;
+            }
+        }
+        std::vector<int> index(nodes.size(), -1);
+        std::vector<Instruction> program;
+        for(int pass = 0; pass < 3; pass++){
+            for(int i = 0; i <= root; i++){
+                if(!live[i]) continue;
+                Instruction ins = nodes[i];
+                int kind = ins.op == Op::Const ? 0 : (ins.op == Op::Var ? 1 : 2);
+                if(kind != pass) continue;
+                if(kind == 2){
+                    ins.a = index[ins.a];
+                    if(is_binary(ins.op)) ins.b = index[ins.b];
+                }
+                index[i] = (int)program.size();
+                program.push_back(ins);
+            }
+        }
+        return program;
+    }
+
+private:
+    std::map<std::tuple<Op, int, int, std::uint64_t>, int> table_;
+
+    int intern(const Instruction& ins){
+        std::uint64_t bits = 0;
+        if(ins.op == Op::Const){
+            double v = ins.value == 0 ? 0.0 : ins.value;  // -0 e +0 são a mesma constante
+            std::memcpy(&bits, &v, sizeof bits);
+        }
+        auto key = std::make_tuple(ins.op, ins.a, ins.b, bits);
+        auto it = table_.find(key);
+        if(it != table_.end()){
+            return it->second;
+        }
+        nodes.push_back(ins);
+        table_.emplace(key, (int)nodes.size() - 1);
+        return (int)nodes.size() - 1;
+    }
+};
+
+// Analisador descendente recursivo da gramática acima, emitindo direto no Builder
+class Expression::Parser {
+public:
+    Parser(const std::string& source, const std::vector<std::string>& variables, const std::map<std::string, double>& constants, Builder& builder)
+        : s_(source), variables_(variables), constants_(constants), b_(builder) {}
+
+    int parse(){
+        int root = expr();
+        skip();
+        if(pos_ < s_.size()){
+            fail("símbolo inesperado '" + std::string(1, s_[pos_]) + "'");
+        }
+        return root;
+    }
+
+private:
+    const std::string& s_;
+    const std::vector<std::string>& variables_;
+    const std::map<std::string, double>& constants_;
+    Builder& b_;
+    std::size_t pos_ = 0;
+
+    [[noreturn]] void fail(const std::string& message) const {
+        throw std::invalid_argument("Expressão inválida: " + message + " (posição " + std::to_string(pos_ + 1) + ")");
+    }
+
+    void skip(){
+        while(pos_ < s_.size() && std::isspace((unsigned char)s_[pos_])){
+            pos_++;
+        }
+    }
+
+    bool accept(const char* token){
+        skip();
+        std::size_t len = std::strlen(token);
+        if(s_.compare(pos_, len, token) == 0){
+            pos_ += len;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(const char* token){
+        if(!accept(token)){
+            fail(std::string("esperado '") + token + "'");
+        }
+    }
+
+    int expr(){
+        int left = term();
+        while(true){
+            if(accept("+")) left = b_.binary(Op::Add, left, term());
+            else if(accept("-")) left = b_.binary(Op::Sub, left, term());
+            else return left;
+        }
+    }
+
+    int term(){
+        int left = unary();
+        while(true){
+            skip();
+            if(accept("*")) left = b_.binary(Op::Mul, left, unary());
+            else if(accept("/")) left = b_.binary(Op::Div, left, unary());
+            else return left;
+        }
+    }
+
+    int unary(){
+        if(accept("-")) return b_.unary(Op::Neg, unary());
+        if(accept("+")) return unary();
+        return power();
+    }
+
+    int power(){
+        int base = primary();
+        if(accept("^") || accept("**")){
+            return b_.binary(Op::Pow, base, unary());
+        }
+        return base;
+    }
+
+    int primary(){
+        skip();
+        if(pos_ >= s_.size()){
+            fail("fim inesperado da expressão");
+        }
+        if(accept("(")){
+            int inner = expr();
+            expect(")");
+            return inner;
+        }
+        char c = s_[pos_];
+        if(std::isdigit((unsigned char)c) || c == '.'){
+            const char* begin = s_.c_str() + pos_;
+            char* end;
+            double v = std::strtod(begin, &end);
+            if(end == begin){
+                fail("número inválido");
+            }
+            pos_ += end - begin;
+            return b_.constant(v);
+        }
+        if(!(std::isalpha((unsigned char)c) || c == '_')){
+            fail("símbolo inesperado '" + std::string(1, c) + "'");
+        }
+        std::size_t start = pos_;
+        while(pos_ < s_.size() && (std::isalnum((unsigned char)s_[pos_]) || s_[pos_] == '_')){
+            pos_++;
+        }
+        std::string name = s_.substr(start, pos_ - start);
+        if(accept("(")){
+            return call(name, start);
+        }
+        for(std::size_t i = 0; i < variables_.size(); i++){
+            if(variables_[i] == name){
+                return b_.variable((int)i);
+            }
+        }
+        auto it = constants_.find(name);
+        if(it != constants_.end()) return b_.constant(it->second);
+        if(name == "pi") return b_.constant(3.14159265358979323846);
+        if(name == "e") return b_.constant(2.71828182845904523536);
+        pos_ = start;
+        fail("nome desconhecido '" + name + "'");
+    }
+
+    int call(const std::string& name, std::size_t start){
+        if(name == "pow"){
+            int base = expr();
+            expect(",");
+            int exponent = expr();
+            expect(")");
+            return b_.binary(Op::Pow, base, exponent);
+        }
+        static const std::map<std::string, Op> functions = {
+            {"sin", Op::Sin}, {"cos", Op::Cos}, {"tan", Op::Tan}, {"asin", Op::Asin}, {"acos", Op::Acos},
+            {"atan", Op::Atan}, {"sinh", Op::Sinh}, {"cosh", Op::Cosh}, {"tanh", Op::Tanh}, {"exp", Op::Exp},
+            {"log", Op::Log}, {"ln", Op::Log}, {"log10", Op::Log10}, {"sqrt", Op::Sqrt}, {"abs", Op::Abs},
+            {"sign", Op::Sign},
+        };
+        auto it = functions.find(name);
+        if(it == functions.end()){
+            pos_ = start;
+            fail("função desconhecida '" + name + "'");
+        }
+        int arg = expr();
+        expect(")");
+        return b_.unary(it->second, arg);
+    }
+};
+
+inline Expression::Expression(const std::string& source, std::vector<std::string> variables, const std::map<std::string, double>& constants)
+    : source_(source), variables_(std::move(variables)){
+    Builder builder;
+    int root = Parser(source_, variables_, constants, builder).parse();
+    set_program(builder.extract(root));
+}
+
+inline double Expression::eval(const double* values) const {
+    // Programas pequenos (o caso comum) usam registradores na pilha, sem alocação
+    double local[64];
+    std::vector<double> heap;
+    double* r = local;
+    if(program_.size() > 64){
+        heap.resize(program_.size());
+        r = heap.data();
+    }
+    const std::size_t n = program_.size();
+    for(std::size_t i = 0; i < first_op_; i++){
+        r[i] = program_[i].op == Op::Const ? program_[i].value : values[program_[i].a];
+    }
+    for(std::size_t i = first_op_; i < n; i++){
+        const Instruction& ins = program_[i];
+        switch(ins.op){
+            case Op::Add: r[i] = r[ins.a] + r[ins.b]; break;
+            case Op::Sub: r[i] = r[ins.a] - r[ins.b]; break;
+            case Op::Mul: r[i] = r[ins.a] * r[ins.b]; break;
+            case Op::Div: r[i] = r[ins.a] / r[ins.b]; break;
+            case Op::Neg: r[i] = -r[ins.a]; break;
+            case Op::Log: r[i] = std::log(r[ins.a]); break;
+            case Op::Exp: r[i] = std::exp(r[ins.a]); break;
+            case Op::Sqrt: r[i] = std::sqrt(r[ins.a]); break;
+            default: r[i] = apply(ins.op, r[ins.a], is_binary(ins.op) ? r[ins.b] : 0); break;
+        }
+    }
+    return r[n - 1];
+}
+
+inline double Expression::operator()(double x) const {
+    if(variables_.size() != 1){
+        throw std::invalid_argument("f(x) disponível apenas para expressões de uma variável!");
+    }
+    return eval(&x);
+}
+
+inline void Expression::eval(const double* x, double* out, std::size_t n) const {
+    if(variables_.size() != 1){
+        throw std::invalid_argument("Avaliação em lote disponível apenas para expressões de uma variável!");
+    }
+    const std::size_t m = program_.size();
+    std::vector<double> regs(m * BATCH);
+    for(std::size_t start = 0; start < n; start += BATCH){
+        const std::size_t len = std::min(BATCH, n - start);
+        for(std::size_t i = 0; i < m; i++){
+            const Instruction& ins = program_[i];
+            double* r = regs.data() + i * BATCH;
+            const double* p = ins.op == Op::Const || ins.op == Op::Var ? nullptr : regs.data() + ins.a * BATCH;
+            const double* q = is_binary(ins.op) ? regs.data() + ins.b * BATCH : nullptr;
+            // Laços simples por operação, para que o compilador os vetorize
+            switch(ins.op){
+                case Op::Const: for(std::size_t k = 0; k < len; k++) r[k] = ins.value; break;
+                case Op::Var: for(std::size_t k = 0; k < len; k++) r[k] = x[start + k]; break;
+                case Op::Add: for(std::size_t k = 0; k < len; k++) r[k] = p[k] + q[k]; break;
+                case Op::Sub: for(std::size_t k = 0; k < len; k++) r[k] = p[k] - q[k]; break;
+                case Op::Mul: for(std::size_t k = 0; k < len; k++) r[k] = p[k] * q[k]; break;
+                case Op::Div: for(std::size_t k = 0; k < len; k++) r[k] = p[k] / q[k]; break;
+                case Op::Neg: for(std::size_t k = 0; k < len; k++) r[k] = -p[k]; break;
+                case Op::Sqrt: for(std::size_t k = 0; k < len; k++) r[k] = std::sqrt(p[k]); break;
+                case Op::Log: for(std::size_t k = 0; k < len; k++) r[k] = std::log(p[k]); break;
+                case Op::Exp: for(std::size_t k = 0; k < len; k++) r[k] = std::exp(p[k]); break;
+                default:
+                    for(std::size_t k = 0; k < len; k++) r[k] = apply(ins.op, p[k], q ? q[k] : 0);
+                    break;
+            }
+        }
+        const double* result = regs.data() + (m - 1) * BATCH;
+        std::copy(result, result + len, out + start);
+    }
+}
+
+inline Expression Expression::derivative(const std::string& variable) const {
+    int v = 0;
+    if(!variable.empty()){
+        v = -1;
+        for(std::size_t i = 0; i < variables_.size(); i++){
+            if(variables_[i] == variable) v = (int)i;
+        }
+        if(v < 0){
+            throw std::invalid_argument("Variável desconhecida '" + variable + "'!");
+        }
+    }
+
+    // O programa derivado começa com os nós do original, de modo que f e f' compartilham subexpressões
+    Builder b(program_);
+    std::vector<int> d(program_.size());
+    const int zero = b.constant(0), one = b.constant(1);
+    for(std::size_t i = 0; i < program_.size(); i++){
+        const Instruction& ins = program_[i];
+        int u = ins.a, w = ins.b, self = (int)i;
+        int du = ins.op == Op::Const || ins.op == Op::Var ? zero : d[u];
+        int dw = is_binary(ins.op) ? d[w] : zero;
+        switch(ins.op){
+            case Op::Const: d[i] = zero; break;
+            case Op::Var: d[i] = ins.a == v ? one : zero; break;
+            case Op::Add: d[i] = b.binary(Op::Add, du, dw); break;
+            case Op::Sub: d[i] = b.binary(Op::Sub, du, dw); break;
+            case Op::Mul: d[i] = b.binary(Op::Add, b.binary(Op::Mul, du, w), b.binary(Op::Mul, u, dw)); break;
+            case Op::Div:
+                // (u/w)' = (u' - (u/w)*w')/w
+                d[i] = b.binary(Op::Div, b.binary(Op::Sub, du, b.binary(Op::Mul, self, dw)), w);
+                break;
+            case Op::Pow:
+                if(b.is_const(w)){
+                    double k = b.nodes[w].value;
+                    d[i] = b.binary(Op::Mul, b.binary(Op::Mul, b.constant(k), b.binary(Op::Pow, u, b.constant(k - 1))), du);
+                }else{
+                    // (u^w)' = u^w * (w'*ln(u) + w*u'/u)
+                    int t = b.binary(Op::Add, b.binary(Op::Mul, dw, b.unary(Op::Log, u)), b.binary(Op::Div, b.binary(Op::Mul, w, du), u));
+                    d[i] = b.binary(Op::Mul, self, t);
+                }
+                break;
+            case Op::Neg: d[i] = b.unary(Op::Neg, du); break;
+            case Op::Sin: d[i] = b.binary(Op::Mul, b.unary(Op::Cos, u), du); break;
+            case Op::Cos: d[i] = b.unary(Op::Neg, b.binary(Op::Mul, b.unary(Op::Sin, u), du)); break;
+            case Op::Tan: d[i] = b.binary(Op::Mul, b.binary(Op::Add, one, b.binary(Op::Mul, self, self)), du); break;
+            case Op::Asin:
+                d[i] = b.binary(Op::Div, du, b.unary(Op::Sqrt, b.binary(Op::Sub, one, b.binary(Op::Mul, u, u))));
+                break;
+            case Op::Acos:
+                d[i] = b.unary(Op::Neg, b.binary(Op::Div, du, b.unary(Op::Sqrt, b.binary(Op::Sub, one, b.binary(Op::Mul, u, u)))));
+                break;
+            case Op::Atan: d[i] = b.binary(Op::Div, du, b.binary(Op::Add, one, b.binary(Op::Mul, u, u))); break;
+            case Op::Sinh: d[i] = b.binary(Op::Mul, b.unary(Op::Cosh, u), du); break;
+            case Op::Cosh: d[i] = b.binary(Op::Mul, b.unary(Op::Sinh, u), du); break;
+            case Op::Tanh: d[i] = b.binary(Op::Mul, b.binary(Op::Sub, one, b.binary(Op::Mul, self, self)), du); break;
+            case Op::Exp: d[i] = b.binary(Op::Mul, self, du); break;
+            case Op::Log: d[i] = b.binary(Op::Div, du, u); break;
+            case Op::Log10: d[i] = b.binary(Op::Div, du, b.binary(Op::Mul, u, b.constant(2.30258509299404568402))); break;
+            case Op::Sqrt: d[i] = b.binary(Op::Div, du, b.binary(Op::Mul, b.constant(2), self)); break;
+            case Op::Abs: d[i] = b.binary(Op::Mul, b.unary(Op::Sign, u), du); break;
+            case Op::Sign: d[i] = zero; break;
+        }
+    }
+
+    Expression result;
+    result.source_ = "d/d" + variables_[v] + "(" + source_ + ")";
+    result.variables_ = variables_;
+    result.set_program(b.extract(d.back()));
+    return result;
+}
+
+/*
+Família f(p, x) a partir de uma expressão nas variáveis p e x (por exemplo "a*d - d*log(d)" com p = "a" e x = "d"),
+com as derivadas df (em x) e dfda (em p) calculadas simbolicamente. Tem a mesma interface de RocketFamily para
+V = double, podendo ser usada nas varreduras de continuation.hpp.
+*/
+struct ExpressionFamily {
+    Expression f_, df_, dfda_;
+
+    ExpressionFamily(const std::string& source, const std::string& p, const std::string& x,
+                     const std::map<std::string, double>& constants = {})
+        : f_(source, {p, x}, constants), df_(f_.derivative(x)), dfda_(f_.derivative(p)) {}
+
+    double f(double p, double x) const { double v[2] = {p, x}; return f_.eval(v); }
+    double df(double p, double x) const { double v[2] = {p, x}; return df_.eval(v); }
+    double dfda(double p, double x) const { double v[2] = {p, x}; return dfda_.eval(v); }
+};
+
+#endif
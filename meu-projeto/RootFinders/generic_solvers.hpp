@@ -0,0 +1,725 @@
+#ifndef GENERIC_SOLVERS_HPP
+#define GENERIC_SOLVERS_HPP
+
+#include "root_finders.hpp"
+#include "trace.hpp"
+#include "dual.hpp"
+#include "metrics.hpp"
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+#include <iostream>
+
+/*
+Versões header-only e templatizadas dos métodos de root_finders.hpp. Recebem qualquer tipo chamável (lambda, functor,
+ponteiro de função, std::function) e, por conhecerem o tipo concreto de f em tempo de compilação, permitem que o
+compilador faça o inline de f(x) dentro dos laços. As funções de root_finders.hpp que recebem std::function são
+apenas wrappers para estas.
+
+Os argumentos, critérios de parada e o retorno são os mesmos documentados em root_finders.hpp, incluindo o
+TraceBuffer opcional para registrar o histórico das iterações.
+*/
+
+namespace generic {
+
+// Método da bissecção
+template <class F>
+Result bisection(F&& f, double a, double b, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    metrics::Scope scope(metrics::BISECTION);
+    double fa = f(a), fb = f(b);
+    double x = a, fx = fa;
+    int evaluations = 2;
+    // Checagem se o intervalo fornecido é válido
+    if(fa * fb >= 0){
+        metrics::invalid_bracket(metrics::BISECTION);
+        throw std::invalid_argument("Intervalo inválido: f(a) e f(b) possuem o mesmo sinal!");
+    }
+    // Imprimir quantidade mínima de interações estimada
+    if(verbose){
+        int min_inter = std::ceil((std::log10(b-a) - std::log10(epsilon))/std::log10(2));
+        std::cout << "Dado o intervalo I = [" << a << "," << b << "], precisão e = " << epsilon << ", o método irá convergir depois de " << min_inter << " passos de iteração.\n";
+    }
+    for(int k = 1; k <= max_inter; k++){
+        x = 0.5 * (a+b);
+        fx = f(x);
+        evaluations++;
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "I = [" << a << ", " << b << "]\n";
+            std::cout << "f(a) = " << fa << "\n";
+            std::cout << "f(b) = " << fb << "\n";
+            std::cout << "x = " << x << "\n";
+            std::cout << "f(x) = " << fx << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x, fx, b - a);
+        }
+        if((b - a) < epsilon){
+            return scope.done(Result{x, k, true, std::abs(fx), std::abs(b-a), evaluations});
+        }
+        // Escolha dos extremos do intervalo da próxima interação
+        if(fx * fa > 0){
+            // se f(x) e f(a) possuem o mesmo sinal
+            a = x;
+            fa = fx;
+        }else{
+            b = x;
+            fb = fx;
+        }
+    }
+    return scope.done(Result{x, max_inter, false, std::abs(fx), std::abs(b-a), evaluations});
+}
+
+// Método da posição falsa
+template <class F>
+Result false_position(F&& f, double a, double b, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    metrics::Scope scope(metrics::FALSE_POSITION);
+    double fa = f(a), fb = f(b);
+    double x = a, fx = fa;
+    int evaluations = 2;
+    // Checagem se o intervalo fornecido é válido
+    if(fa * fb >= 0){
+        metrics::invalid_bracket(metrics::FALSE_POSITION);
+        throw std::invalid_argument("Intervalo inválido: f(a) e f(b) possuem o mesmo sinal!");
+    }
+    for(int k = 1; k <= max_inter; k++){
+        x = (a*fb - b*fa)/(fb - fa);
+        fx = f(x);
+        evaluations++;
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "I = [" << a << ", " << b << "]\n";
+            std::cout << "f(a) = " << fa << "\n";
+            std::cout << "f(b) = " << fb << "\n";
+            std::cout << "x = " << x << "\n";
+            std::cout << "f(x) = " << fx << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x, fx, std::abs(b - a));
+        }
+
+        if(std::abs(b - a) < epsilon){
+            return scope.done(Result{x, k, true, std::abs(fx), std::abs(b-a), evaluations});
+        }
+
+        // Escolha dos extremos do intervalo da próxima interação
+        if(fx * fa > 0){
+            // se f(x) e f(a) possuem o mesmo sinal
+            a = x;
+            fa = fx;
+        }else{
+            b = x;
+            fb = fx;
+        }
+
+        //Criterio de parada baseado na diferença entre o resultado anterior e o resultado atual
+        if(std::abs(fx) < epsilon){
+            return scope.done(Result{x, k, true, std::abs(fx), std::abs(fx), evaluations});
+        }
+    }
+    return scope.done(Result{x, max_inter, false, std::abs(fx), std::abs(b-a), evaluations});
+}
+
+// Método de Brent, a partir de um barramento com f(a) e f(b) já calculados (contados em function_evaluations)
+template <class F>
+Result brent(F&& f, const Bracket& bracket, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    metrics::Scope scope(metrics::BRENT);
+    double a = bracket.a, b = bracket.b;
+    double fa = bracket.fa, fb = bracket.fb;
+    int evaluations = 2;
+    // Checagem se o intervalo fornecido é válido
+    if(fa * fb >= 0){
+        metrics::invalid_bracket(metrics::BRENT);
+        throw std::invalid_argument("Intervalo inválido: f(a) e f(b) possuem o mesmo sinal!");
+    }
+    // b é a melhor aproximação, [b, c] (ou [c, b]) contém a raíz e a é a aproximação anterior de b
+    double c = a, fc = fa;
+    double d = b - a, e = d;
+    for(int k = 1; k <= max_inter; k++){
+        if((fb > 0) == (fc > 0)){
+            c = a;
+            fc = fa;
+            d = e = b - a;
+        }
+        if(std::abs(fc) < std::abs(fb)){
+            a = b; b = c; c = a;
+            fa = fb; fb = fc; fc = fa;
+        }
+        double tol = 2 * DBL_EPSILON * std::abs(b) + 0.5 * epsilon;
+        double m = 0.5 * (c - b);
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "I = [" << std::min(b, c) << ", " << std::max(b, c) << "]\n";
+            std::cout << "x = " << b << "\n";
+            std::cout << "f(x) = " << fb << "\n\n";
+        }
+        if(trace){
+            trace->record(k, b, fb, std::abs(c - b));
+        }
+        if(std::abs(m) <= tol || fb == 0){
+            return scope.done(Result{b, k, true, std::abs(fb), std::abs(c - b), evaluations});
+        }
+        if(std::abs(e) >= tol && std::abs(fa) > std::abs(fb)){
+            // Interpolação: secante se só há dois pontos distintos, quadrática inversa caso contrário
+            double p, q, s = fb / fa;
+            if(a == c){
+                p = 2 * m * s;
+                q = 1 - s;
+            }else{
+                double r = fb / fc;
+                q = fa / fc;
+                p = s * (2 * m * q * (q - r) - (b - a) * (r - 1));
+                q = (q - 1) * (r - 1) * (s - 1);
+            }
+            if(p > 0){
+                q = -q;
+            }else{
+                p = -p;
+            }
+            // Aceita a interpolação apenas se ela cair dentro do intervalo e reduzir o passo o suficiente
+            if(2 * p < std::min(3 * m * q - std::abs(tol * q), std::abs(e * q))){
+                e = d;
+                d = p / q;
+            }else{
+                d = e = m;
+            }
+        }else{
+            // Passo de bissecção
+            d = e = m;
+        }
+        a = b;
+        fa = fb;
+        b += std::abs(d) > tol ? d : (m > 0 ? tol : -tol);
+        fb = f(b);
+        evaluations++;
+    }
+    return scope.done(Result{b, max_inter, false, std::abs(fb), std::abs(c - b), evaluations});
+}
+
+// Método de Brent
+template <class F>
+Result brent(F&& f, double a, double b, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    return brent(f, Bracket{a, b, f(a), f(b)}, epsilon, max_inter, verbose, trace);
+}
+
+// Método de Illinois (posição falsa modificada, com o fator de Anderson-Björck)
+template <class F>
+Result illinois(F&& f, double a, double b, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    metrics::Scope scope(metrics::ILLINOIS);
+    double fa = f(a), fb = f(b);
+    double x = a, fx = fa;
+    int evaluations = 2;
+    // Checagem se o intervalo fornecido é válido
+    if(fa * fb >= 0){
+        metrics::invalid_bracket(metrics::ILLINOIS);
+        throw std::invalid_argument("Intervalo inválido: f(a) e f(b) possuem o mesmo sinal!");
+    }
+    for(int k = 1; k <= max_inter; k++){
+        x = (a*fb - b*fa)/(fb - fa);
+        fx = f(x);
+        evaluations++;
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "I = [" << a << ", " << b << "]\n";
+            std::cout << "f(a) = " << fa << "\n";
+            std::cout << "f(b) = " << fb << "\n";
+            std::cout << "x = " << x << "\n";
+            std::cout << "f(x) = " << fx << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x, fx, std::abs(b - a));
+        }
+        if(fx == 0){
+            return scope.done(Result{x, k, true, 0.0, 0.0, evaluations});
+        }
+        if(fx * fb < 0){
+            // A raíz está entre x e b: o extremo antigo b é mantido e x substitui a
+            a = b;
+            fa = fb;
+        }else{
+            // O extremo a ficaria parado (o que trava a posição falsa em funções convexas): seu valor é
+            // reduzido pelo fator de Anderson-Björck, ou pela metade (Illinois) quando esse fator não é positivo
+            double factor = 1 - fx / fb;
+            fa *= factor > 0 ? factor : 0.5;
+        }
+        b = x;
+        fb = fx;
+        if(std::abs(b - a) < epsilon){
+            return scope.done(Result{x, k, true, std::abs(fx), std::abs(b - a), evaluations});
+        }
+    }
+    return scope.done(Result{x, max_inter, false, std::abs(fx), std::abs(b - a), evaluations});
+}
+
+// Método ITP (Interpolate, Truncate and Project)
+template <class F>
+Result itp(F&& f, double a, double b, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    metrics::Scope scope(metrics::ITP);
+    double fa = f(a), fb = f(b);
+    double x = a, fx = fa;
+    int evaluations = 2;
+    // Checagem se o intervalo fornecido é válido
+    if(fa * fb >= 0){
+        metrics::invalid_bracket(metrics::ITP);
+        throw std::invalid_argument("Intervalo inválido: f(a) e f(b) possuem o mesmo sinal!");
+    }
+    if(a > b){
+        std::swap(a, b);
+        std::swap(fa, fb);
+    }
+    // Parâmetros usuais do método: kappa1 = 0.2/(b - a), kappa2 = 2 e n0 = 1 interação de folga sobre a bissecção
+    const double kappa1 = 0.2 / (b - a), kappa2 = 2;
+    const int n_max = std::max(0, (int)std::ceil(std::log2((b - a) / epsilon))) + 1;
+    for(int k = 1; k <= max_inter; k++){
+        double width = b - a;
+        if(width < epsilon){
+            return scope.done(Result{x, k - 1, true, std::abs(fx), width, evaluations});
+        }
+        double x_half = 0.5 * (a + b);
+        // Raio de projeção: garante no máximo n_max interações, como uma bissecção com n0 passos a mais
+        double r = 0.5 * epsilon * std::ldexp(1.0, n_max - k + 1) - 0.5 * width;
+        // Interpolação (posição falsa)
+        double x_f = (a*fb - b*fa)/(fb - fa);
+        // Truncamento: afasta x_f do ponto médio por delta
+        double sigma = x_half >= x_f ? 1 : -1;
+        double delta = kappa1 * std::pow(width, kappa2);
+        double x_t = delta <= std::abs(x_half - x_f) ? x_f + sigma*delta : x_half;
+        // Projeção sobre a vizinhança de raio r do ponto médio
+        x = std::abs(x_t - x_half) <= r ? x_t : x_half - sigma*r;
+        // Perto da precisão pedida, delta fica abaixo do arredondamento e x cairia sobre um dos extremos:
+        // mantém x a pelo menos epsilon/4 deles para que o intervalo continue diminuindo
+        double guard = 0.25 * std::min(epsilon, width);
+        x = std::min(std::max(x, a + guard), b - guard);
+        fx = f(x);
+        evaluations++;
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "I = [" << a << ", " << b << "]\n";
+            std::cout << "f(a) = " << fa << "\n";
+            std::cout << "f(b) = " << fb << "\n";
+            std::cout << "x = " << x << "\n";
+            std::cout << "f(x) = " << fx << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x, fx, width);
+        }
+        if(fx == 0){
+            return scope.done(Result{x, k, true, 0.0, 0.0, evaluations});
+        }
+        if((fx > 0) == (fa > 0)){
+            a = x;
+            fa = fx;
+        }else{
+            b = x;
+            fb = fx;
+        }
+    }
+    return scope.done(Result{x, max_inter, false, std::abs(fx), b - a, evaluations});
+}
+
+// Método do ponto fixo
+template <class Phi>
+Result fixed_point(Phi&& phi, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    metrics::Scope scope(metrics::FIXED_POINT);
+    double x1 = x0, step = 0;
+    int evaluations = 0;
+    for(int k = 0; k <= max_inter; k++){
+        x1 = phi(x0);
+        evaluations++;
+        step = std::abs(x1 - x0);
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "x = " << x0 << "\n";
+            std::cout << "phi(x) = " << x1 << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x0, x1, step);
+        }
+        // Verificação do critério de parada |xk - xk-1| < epsilon
+        if(step < epsilon){
+            return scope.done(Result{x1, k, true, step, step, evaluations});
+        }
+        x0 = x1;
+    }
+    return scope.done(Result{x1, max_inter, false, step, step, evaluations});
+}
+
+// Método do ponto fixo com extrapolação de Aitken (delta²)
+template <class Phi>
+Result fixed_point_aitken(Phi&& phi, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    metrics::Scope scope(metrics::FIXED_POINT_AITKEN);
+    // A sequência de Picard xk+1 = phi(xk) não é alterada; a cada três termos xk-1, xk, xk+1 a estimativa é
+    // x^ = xk+1 - (xk+1 - xk)²/((xk+1 - xk) - (xk - xk-1))
+    double x1 = phi(x0), x2 = x1, estimate = x1, previous = x0;
+    double step = std::abs(x1 - x0), error = step;
+    int evaluations = 1;
+    if(step < epsilon){
+        return scope.done(Result{x1, 0, true, step, step, evaluations});
+    }
+    for(int k = 1; k <= max_inter; k++){
+        x2 = phi(x1);
+        evaluations++;
+        step = std::abs(x2 - x1);
+        double second = (x2 - x1) - (x1 - x0);
+        double candidate = x2 - (x2 - x1)*(x2 - x1)/second;
+        // Salvaguarda: sem extrapolação quando a segunda diferença se anula ou a estimativa não é finita
+        estimate = second != 0 && std::isfinite(candidate) ? candidate : x2;
+        error = std::abs(estimate - previous);
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "x = " << x1 << "\n";
+            std::cout << "phi(x) = " << x2 << "\n";
+            std::cout << "x (Aitken) = " << estimate << "\n\n";
+        }
+        if(trace){
+            trace->record(k, estimate, x2, error);
+        }
+        // Verificação do critério de parada |x^k - x^k-1| < epsilon (ou da própria sequência, |xk+1 - xk| < epsilon)
+        if(error < epsilon || step < epsilon){
+            return scope.done(Result{estimate, k, true, step, error, evaluations});
+        }
+        previous = estimate;
+        x0 = x1;
+        x1 = x2;
+    }
+    return scope.done(Result{estimate, max_inter, false, step, error, evaluations});
+}
+
+// Método de Steffensen
+template <class Phi>
+Result steffensen(Phi&& phi, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    metrics::Scope scope(metrics::STEFFENSEN);
+    // Cada iteração avalia x1 = phi(x) e x2 = phi(x1) e recomeça da extrapolação de Aitken desses três pontos.
+    // Salvaguarda: se o ponto extrapolado não reduz |phi(x) - x| em relação ao ponto anterior (ou phi não é finita
+    // nele), ele é descartado e a iteração segue de x2, os dois passos simples já calculados
+    double x = x0, x1 = x0, step = INFINITY, previous_step = INFINITY, plain = x0;
+    bool accelerated = false;
+    int evaluations = 0;
+    for(int k = 1; k <= max_inter; k++){
+        x1 = phi(x);
+        evaluations++;
+        step = std::abs(x1 - x);
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "x = " << x << "\n";
+            std::cout << "phi(x) = " << x1 << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x, x1, step);
+        }
+        if(accelerated && !(step < previous_step)){
+            x = plain;
+            accelerated = false;
+            continue;
+        }
+        // Verificação do critério de parada |phi(x) - x| < epsilon
+        if(step < epsilon){
+            return scope.done(Result{x1, k, true, step, step, evaluations});
+        }
+        double x2 = phi(x1);
+        evaluations++;
+        double second = x2 - 2*x1 + x;
+        metrics::check_division(metrics::STEFFENSEN, second);
+        double candidate = x - (x1 - x)*(x1 - x)/second;
+        previous_step = step;
+        if(second != 0 && std::isfinite(candidate)){
+            plain = x2;
+            x = candidate;
+            accelerated = true;
+        }else{
+            x = x2;
+            accelerated = false;
+        }
+    }
+    return scope.done(Result{x1, max_inter, false, step, step, evaluations});
+}
+
+// Janela máxima do método de Anderson (o histórico fica em arrays de tamanho fixo, sem alocação)
+const int ANDERSON_MAX_WINDOW = 8;
+
+// Método do ponto fixo com mistura de Anderson
+template <class Phi>
+Result anderson(Phi&& phi, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr, int window=2){
+    metrics::Scope scope(metrics::ANDERSON);
+    /*
+    Com gk = phi(xk) e fk = gk - xk, o próximo ponto é xk+1 = gk - sum gamma_i dg_i, onde dg_i e df_i são as
+    diferenças consecutivas de g e f nos últimos window + 1 pontos e gamma minimiza |fk - sum gamma_i df_i|. Em
+    uma dimensão esse mínimo tem uma equação só, e a solução de norma mínima dá
+
+        xk+1 = gk - fk * (sum df_i dg_i) / (sum df_i²)
+
+    ou seja, a secante em f(x) = phi(x) - x com uma inclinação média da janela (com window = 1 é a própria secante).
+    Salvaguarda: se o ponto acelerado não reduz |fk| (ou phi não é finita nele), ele é descartado, o histórico é
+    esvaziado e a iteração segue do passo simples gk-1.
+    */
+    window = std::max(1, std::min(window, ANDERSON_MAX_WINDOW));
+    double fs[ANDERSON_MAX_WINDOW + 1], gs[ANDERSON_MAX_WINDOW + 1];
+    int stored = 0;
+    double x = x0, g = x0, step = INFINITY, previous_step = INFINITY, plain = x0;
+    bool accelerated = false;
+    int evaluations = 0;
+    for(int k = 1; k <= max_inter; k++){
+        g = phi(x);
+        evaluations++;
+        double f = g - x;
+        step = std::abs(f);
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "x = " << x << "\n";
+            std::cout << "phi(x) = " << g << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x, g, step);
+        }
+        if(accelerated && !(step < previous_step)){
+            x = plain;
+            stored = 0;
+            accelerated = false;
+            continue;
+        }
+        // Verificação do critério de parada |phi(x) - x| < epsilon
+        if(step < epsilon){
+            return scope.done(Result{g, k, true, step, step, evaluations});
+        }
+        if(stored == window + 1){
+            std::copy(fs + 1, fs + stored, fs);
+            std::copy(gs + 1, gs + stored, gs);
+            stored--;
+        }
+        fs[stored] = f;
+        gs[stored] = g;
+        stored++;
+
+        double num = 0, den = 0;
+        for(int i = 0; i + 1 < stored; i++){
+            double df = fs[i + 1] - fs[i];
+            num += df * (gs[i + 1] - gs[i]);
+            den += df * df;
+        }
+        if(stored > 1){
+            metrics::check_division(metrics::ANDERSON, den);
+        }
+        double candidate = g - f * num / den;
+        previous_step = step;
+        plain = g;
+        if(den > 0 && std::isfinite(candidate)){
+            x = candidate;
+            accelerated = true;
+        }else{
+            x = g;
+            accelerated = false;
+        }
+    }
+    return scope.done(Result{g, max_inter, false, step, step, evaluations});
+}
+
+// Método de Newton-Raphson
+template <class F, class DF>
+Result newton_raphson(F&& f, DF&& df, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    metrics::Scope scope(metrics::NEWTON_RAPHSON);
+    double x = x0, step = 0;
+    // f(xk) é reaproveitado como f(xk-1) na iteração seguinte
+    double fx0 = f(x0), fx = fx0;
+    int evaluations = 1;
+    for(int k = 1; k <= max_inter; k++){
+        double dfx0 = df(x0);
+        metrics::check_division(metrics::NEWTON_RAPHSON, dfx0);
+        x = x0 - fx0/dfx0; // xk = xk-1 - f(xk-1)/f'(xk-1)
+        fx = f(x);
+        evaluations += 2;
+        // Salvaguarda: com a derivada nula o passo não é finito, e com xk fora do domínio de f, f(xk) não é finita.
+        // Nos dois casos o método para sem convergência, na última aproximação finita
+        if(!std::isfinite(x) || !std::isfinite(fx)){
+            return scope.done(Result{x0, k, false, std::abs(fx0), INFINITY, evaluations});
+        }
+        step = std::abs(x - x0);
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "x = " << x << "\n";
+            std::cout << "f(x) = " << fx << "\n";
+            std::cout << "f'(x_anterior) = " << dfx0 << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x, fx, step);
+        }
+        // Verificação do critério de parada |xk - xk-1| < epsilon
+        if(step < epsilon){
+            return scope.done(Result{x, k, true, std::abs(fx), step, evaluations});
+        }
+        x0 = x;
+        fx0 = fx;
+    }
+    return scope.done(Result{x, max_inter, false, std::abs(fx), step, evaluations});
+}
+
+// Método de Newton-Raphson com diferenciação automática
+template <class F>
+Result newton_raphson_ad(F&& f, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    metrics::Scope scope(metrics::NEWTON_RAPHSON_AD);
+    double x = x0, step = 0;
+    // Uma única avaliação de f em números duais dá f(xk) e f'(xk), reaproveitados na iteração seguinte
+    ad::Dual y0 = f(ad::Dual(x0, 1)), y = y0;
+    int evaluations = 1;
+    for(int k = 1; k <= max_inter; k++){
+        metrics::check_division(metrics::NEWTON_RAPHSON_AD, y0.d);
+        x = x0 - y0.v/y0.d; // xk = xk-1 - f(xk-1)/f'(xk-1)
+        y = f(ad::Dual(x, 1));
+        evaluations++;
+        // Salvaguarda: com a derivada nula o passo não é finito, e com xk fora do domínio de f, f(xk) não é finita.
+        // Nos dois casos o método para sem convergência, na última aproximação finita
+        if(!std::isfinite(x) || !std::isfinite(y.v)){
+            return scope.done(Result{x0, k, false, std::abs(y0.v), INFINITY, evaluations});
+        }
+        step = std::abs(x - x0);
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "x = " << x << "\n";
+            std::cout << "f(x) = " << y.v << "\n";
+            std::cout << "f'(x_anterior) = " << y0.d << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x, y.v, step);
+        }
+        if(step < epsilon){
+            return scope.done(Result{x, k, true, std::abs(y.v), step, evaluations});
+        }
+        x0 = x;
+        y0 = y;
+    }
+    return scope.done(Result{x, max_inter, false, std::abs(y.v), step, evaluations});
+}
+
+// Método de Halley (diferenciação automática de segunda ordem)
+template <class F>
+Result halley(F&& f, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    metrics::Scope scope(metrics::HALLEY);
+    double x = x0, step = 0;
+    ad::Dual2 y0 = f(ad::Dual2(x0, 1, 0)), y = y0;
+    int evaluations = 1;
+    for(int k = 1; k <= max_inter; k++){
+        metrics::check_division(metrics::HALLEY, 2*y0.d*y0.d - y0.v*y0.d2);
+        x = x0 - 2*y0.v*y0.d / (2*y0.d*y0.d - y0.v*y0.d2); // xk = xk-1 - 2ff'/(2f'^2 - ff'')
+        y = f(ad::Dual2(x, 1, 0));
+        evaluations++;
+        // Salvaguarda: com a derivada nula o passo não é finito, e com xk fora do domínio de f, f(xk) não é finita.
+        // Nos dois casos o método para sem convergência, na última aproximação finita
+        if(!std::isfinite(x) || !std::isfinite(y.v)){
+            return scope.done(Result{x0, k, false, std::abs(y0.v), INFINITY, evaluations});
+        }
+        step = std::abs(x - x0);
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "x = " << x << "\n";
+            std::cout << "f(x) = " << y.v << "\n";
+            std::cout << "f'(x_anterior) = " << y0.d << "\n";
+            std::cout << "f''(x_anterior) = " << y0.d2 << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x, y.v, step);
+        }
+        if(step < epsilon){
+            return scope.done(Result{x, k, true, std::abs(y.v), step, evaluations});
+        }
+        x0 = x;
+        y0 = y;
+    }
+    return scope.done(Result{x, max_inter, false, std::abs(y.v), step, evaluations});
+}
+
+// Método da Secante
+template <class F>
+Result secant(F&& f, double x0, double x1, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+    metrics::Scope scope(metrics::SECANT);
+    double aux;
+    double fx0 = f(x0), fx1 = f(x1);
+    int evaluations = 2;
+    for(int k = 0; k <= max_inter; k++){
+        double dfx = fx1 - fx0;
+        // Checagem se f(x1) e f(x0) são iguais na interação k -> Evitar divisão por zero!
+        metrics::check_division(metrics::SECANT, dfx);
+        if(dfx == 0){
+            if(verbose){
+                std::cout << "Etapa de refinamento interrompida! Valores f(xk) e f(xk-1) muito próximos, possível ocorrência de divisão por zero!\n";
+            }
+            // Só convergiu se x1 já é raíz ou já satisfaz o critério de parada
+            bool converged = fx1 == 0 || std::abs(x1 - x0) < epsilon;
+            return scope.done(Result{x1, k, converged, std::abs(fx1), std::abs(x1-x0), evaluations});
+        }
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "x0 = " << x0 << "\n";
+            std::cout << "x1 = " << x1 << "\n";
+            std::cout << "f(x0) = " << fx0 << "\n";
+            std::cout << "f(x1) = " << fx1 << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x1, fx1, std::abs(x1 - x0));
+        }
+        // Verificação do critério de parada |xk - xk-1| < epsilon
+        if(std::abs(x1 - x0) < epsilon){
+            return scope.done(Result{x1, k, true, std::abs(fx1), std::abs(x1-x0), evaluations});
+        }
+        aux = (x0 * fx1 - x1*fx0)/dfx;
+        x0 = x1;
+        fx0 = fx1;
+        x1 = aux;
+        fx1 = f(x1);
+        evaluations++;
+    }
+    return scope.done(Result{x1, max_inter, false, std::abs(fx1), std::abs(x1-x0), evaluations});
+}
+
+// Método de Newton-Raphson para polinômios de grau fixo
+template <int N>
+constexpr Result polynomial_newton_raphson(const FixedPolynomial<N>& p, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr){
+/*
+Mesmo método de polynomial_newton_raphson (root_finders.hpp), especializado para o grau N: p e p' são avaliados
+pelas passadas desenroladas de FixedPolynomial. Sem verbose e sem trace a função é constexpr, então com p e x0
+constantes a raíz pode ser calculada em tempo de compilação:
+
+    constexpr Result r = generic::polynomial_newton_raphson(FixedPolynomial(1.0, 0.0, -2.0, -5.0), 2.0, 1e-12);
+    static_assert(r.converged);
+*/
+    double x = x0, step = 0;
+    double px0 = 0, dpx0 = 0;
+    p.eval(x0, px0, dpx0);
+    double px = px0, dpx = dpx0;
+    int evaluations = 2;
+    for(int k = 0; k <= max_inter; k++){
+        // Salvaguarda de newton_raphson com p'(xk-1) nula ou passo não finito, testada sem dividir por zero e sem
+        // std::isfinite (não constexpr): x - x só é zero para x finito
+        if(dpx0 == 0){
+            return {x0, k, false, px0 < 0 ? -px0 : px0, INFINITY, evaluations};
+        }
+        x = x0 - px0/dpx0;
+        if(x - x != 0){
+            return {x0, k, false, px0 < 0 ? -px0 : px0, INFINITY, evaluations};
+        }
+        p.eval(x, px, dpx);
+        evaluations += 2;
+        // std::abs não é constexpr em C++17
+        step = x > x0 ? x - x0 : x0 - x;
+        if(verbose){
+            std::cout << "========== Iteração " << k << " ==========\n";
+            std::cout << "x = " << x << "\n";
+            std::cout << "p(x) = " << px << "\n";
+            std::cout << "p'(x_anterior) = " << dpx0 << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x, px, step);
+        }
+        if(step < epsilon){
+            return {x, k, true, px < 0 ? -px : px, step, evaluations};
+        }
+        x0 = x;
+        px0 = px;
+        dpx0 = dpx;
+    }
+    return {x, max_inter, false, px < 0 ? -px : px, step, evaluations};
+}
+
+} // namespace generic
+
+#endif
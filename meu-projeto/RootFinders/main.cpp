@@ -1,12 +1,19 @@
-#include "root_finders.cpp"
+#include "root_finders.hpp"
+#include "generic_solvers.hpp"
+#include "expression.hpp"
+#include "metrics.hpp"
+#include "result_cache.hpp"
+#include "numeric_boards.hpp"
 #include <iomanip>
 #include <emscripten/bind.h>
+#include <emscripten/val.h>
 
 using namespace std;
 
 /*
 
-- fa retorna a função dada de acordo com o valor de 'a', dfa retorna a derivada de fa.
+- fa (numeric_boards.hpp) retorna a função dada de acordo com o valor de 'a', e newton_fa aplica o Newton-Raphson a
+ela, com a derivada obtida por diferenciação automática (foguete) ou simbolicamente (funcao_usuario)
 
 - os métodos com '2' no final são adaptações dos métodos originais, seja adicionando um critério de parada que não
 tinha ou só tirando o bool responsável pelos prints
@@ -29,18 +36,24 @@ vector<string> resultToVecString (Result x){
     return v;
 }
 
-function<double(double)> fa(double a){
-    return [a](double d){
-        return a*d - d*log(d);
-    };
-
-}
-
-function<double(double)> dfa(double a){
-    return [a](double d){
-        return a - log(d) - 1;
-    };
+// Expressão de f nas variáveis a e d definida por set_function (vazia: fa(a) = ad - dln(d))
+string funcao_usuario;
 
+/*
+Troca a função resolvida pelos quadros por uma expressão em a e d, compilada em tempo de execução (expression.hpp),
+com a derivada do Newton-Raphson calculada simbolicamente. Uma expressão vazia volta para fa(a).
+Retorna a mensagem de erro da compilação, ou uma string vazia se a expressão é válida.
+*/
+string set_function(string expressao){
+    try{
+        if(!expressao.empty()){
+            ExpressionFamily validacao(expressao, "a", "d");
+        }
+    }catch(const invalid_argument& erro){
+        return erro.what();
+    }
+    funcao_usuario = expressao;
+    return "";
 }
 
 
@@ -51,32 +64,18 @@ vector<vector<vector<string>>> quadro_comparativo(vector<double> a_foguetes, dou
 
     for(int i = 0; i < a_foguetes.size(); i++){
 
-        /*A solução da equação ad - dln(d) é d = e^a, 
-        seja [A,B] o barramento, então devemos ter A <= e^a e e^B >= e^b
-        para que seja possível a convergencia
-        
-        
-        Portanto, usaremos o barramento [2^a,3^a] se a > 0 e [3^a, 2^a] se a < 0
-        
-        No caso do Newton-Raphson, podemos utilizar o valor inicial de x0 = 2.7^a, ja que é proximo do valor de e^a
-        
-        */
-
-        double a_barramento = a_foguetes[i] < 0 ?  pow((double)3, a_foguetes[i]) : pow((double)2, a_foguetes[i]);
-        double b_barramento =  a_foguetes[i] < 0 ?  pow((double)2, a_foguetes[i]) : pow((double)3, a_foguetes[i]);
-        a_barramento = a_foguetes[i] == 0 ?  0.98 : a_barramento;
-        b_barramento =  a_foguetes[i] == 0 ?  1.02 : b_barramento;
-        double x0 = pow((double)2.7, a_foguetes[i]);
+        double a_barramento, b_barramento, x0;
+        barramento(a_foguetes[i], a_barramento, b_barramento, x0);
 
 
         /*Um board tem o seguinte formato:
-            vec_text    vec_bissection  vec_false_pos  vec_new_raph
-        | a_i           | bisecção   | posição falsa | Newton Raphson |
-        | Dados Iniciais| [A, B]     | [A, B]        | x0 = value     |
-        | x             |            |               |                |
-        | f(x)          |            |               |                |
-        | Erro          |            |               |                |
-        | Num Inter     |            |               |                |
+            vec_text    vec_bissection  vec_false_pos  vec_new_raph  vec_brent
+        | a_i           | bisecção   | posição falsa | Newton Raphson | Brent  |
+        | Dados Iniciais| [A, B]     | [A, B]        | x0 = value     | [A, B] |
+        | x             |            |               |                |        |
+        | f(x)          |            |               |                |        |
+        | Erro          |            |               |                |        |
+        | Num Inter     |            |               |                |        |
         
         */
 
@@ -85,19 +84,23 @@ vector<vector<vector<string>>> quadro_comparativo(vector<double> a_foguetes, dou
         vector<string> vec_bissection = {"Bissecção", "[" + to_string(a_barramento)+ "," + to_string(b_barramento) + "]"};
         vector<string> vec_false_pos = {"Posição Falsa",  "[" + to_string(a_barramento) + "," + to_string(b_barramento) + "]"};
         vector<string> vec_new_raph = {"Newton Raphson", "x_0 = " + to_string(x0)};
+        vector<string> vec_brent = {"Brent", "[" + to_string(a_barramento) + "," + to_string(b_barramento) + "]"};
 
-        vector<string> bissection_result = resultToVecString(bisection(fa(a_foguetes[i]), a_barramento, b_barramento, error, max_iter, true));
-        vector<string> false_pos_result = resultToVecString(false_position(fa(a_foguetes[i]), a_barramento, b_barramento, error, max_iter, true));
-        vector<string> new_raph_result = resultToVecString(newton_raphson(fa(a_foguetes[i]), dfa(a_foguetes[i]), x0 , error, max_iter));
+        vector<string> bissection_result = resultToVecString(bisection(fa(funcao_usuario, a_foguetes[i]), a_barramento, b_barramento, error, max_iter));
+        vector<string> false_pos_result = resultToVecString(false_position(fa(funcao_usuario, a_foguetes[i]), a_barramento, b_barramento, error, max_iter));
+        vector<string> new_raph_result = resultToVecString(newton_fa(funcao_usuario, a_foguetes[i], x0, error, max_iter));
+        vector<string> brent_result = resultToVecString(brent(fa(funcao_usuario, a_foguetes[i]), a_barramento, b_barramento, error, max_iter));
 
         vec_bissection.insert(vec_bissection.end(), bissection_result.begin(), bissection_result.end());
         vec_false_pos.insert(vec_false_pos.end(), false_pos_result.begin(), false_pos_result.end());
         vec_new_raph.insert(vec_new_raph.end(), new_raph_result.begin(), new_raph_result.end());
+        vec_brent.insert(vec_brent.end(), brent_result.begin(), brent_result.end());
 
         comp_board.push_back(vec_text);
         comp_board.push_back(vec_bissection);
         comp_board.push_back(vec_false_pos);
         comp_board.push_back(vec_new_raph);
+        comp_board.push_back(vec_brent);
 
         boards.push_back(comp_board);
     }
@@ -107,6 +110,93 @@ vector<vector<vector<string>>> quadro_comparativo(vector<double> a_foguetes, dou
 }
 
 
+
+/*
+Versão numérica de quadro_comparativo para o front-end. Em vez de strings, os resultados são escritos em dois
+buffers contíguos na memória do WASM, no formato de numeric_boards.hpp, e expostos ao JS como
+Float64Array/Int32Array (sem cópia).
+
+Se registrar_historico for verdadeiro, cada iteração de cada método é registrada em um TraceBuffer exposto como
+Float64Array (trace, 4 valores por registro: k, x, f(x), largura do intervalo ou passo). O buffer é reservado uma
+única vez com espaço para max_iter + 1 registros por método.
+
+As views apontam para buffers reutilizados: são válidas apenas até a próxima chamada (ou até a memória do WASM
+crescer), então o JS deve copiá-las (slice) se quiser guardar os valores.
+
+Os resultados (com o histórico) ficam em result_cache entre as chamadas, com a chave (funcao_usuario, a, error,
+max_iter, método): ao repetir a lista com um foguete a mais ou a menos, só os valores de a novos são resolvidos,
+e f (compilada quando vem de set_function) só é construída quando algum método de a não está no cache.
+*/
+vector<double> numeric_doubles;
+vector<int> numeric_ints;
+TraceBuffer numeric_trace;
+ResultCache result_cache;
+
+emscripten::val quadro_comparativo_numerico(emscripten::val a_js, double error, int max_iter, bool registrar_historico){
+    vector<double> a_foguetes = emscripten::convertJSArrayToNumberVector<double>(a_js);
+    int n = a_foguetes.size();
+    numeric_doubles.assign(n*METODOS*DOUBLES_POR_METODO, 0);
+    numeric_ints.assign(n*METODOS*INTS_POR_METODO, 0);
+    numeric_trace.clear();
+    if(registrar_historico){
+        numeric_trace.reserve((size_t)n*METODOS*(max_iter + 1));
+    }
+    TraceBuffer* trace = registrar_historico ? &numeric_trace : nullptr;
+
+    for(int i = 0; i < n; i++){
+        resolve_quadro(a_foguetes[i], funcao_usuario, error, max_iter, trace,
+                       &numeric_doubles[i*METODOS*DOUBLES_POR_METODO], &numeric_ints[i*METODOS*INTS_POR_METODO], &result_cache);
+    }
+
+    emscripten::val nomes = emscripten::val::array();
+    for(const char* nome: NOMES_METODOS){
+        nomes.call<void>("push", string(nome));
+    }
+
+    emscripten::val out = emscripten::val::object();
+    out.set("count", n);
+    out.set("methods", nomes);
+    out.set("doubleStride", DOUBLES_POR_METODO);
+    out.set("intStride", INTS_POR_METODO);
+    out.set("doubles", emscripten::val(emscripten::typed_memory_view(numeric_doubles.size(), numeric_doubles.data())));
+    out.set("ints", emscripten::val(emscripten::typed_memory_view(numeric_ints.size(), numeric_ints.data())));
+    out.set("traceStride", 4);
+    out.set("trace", emscripten::val(emscripten::typed_memory_view(4*numeric_trace.size(), (const double*)numeric_trace.data())));
+    return out;
+}
+
+
+// Contadores de metrics.hpp em JSON (com "enabled": false se o módulo foi compilado sem RF_METRICS)
+string metrics_json(){
+    return metrics::to_json();
+}
+
+/*
+Estatísticas do cache de resultados desta instância do módulo: {hits, misses, evictions, entries, bytes, capacity}.
+A taxa de acerto (hits / (hits + misses)) junto com bytes / entries dá o tamanho necessário para a lista de
+foguetes em uso; set_cache_capacity ajusta o limite (em bytes) e clear_cache esvazia o cache e zera os contadores.
+*/
+emscripten::val cache_stats(){
+    CacheStats s = result_cache.stats();
+    emscripten::val out = emscripten::val::object();
+    out.set("hits", (double)s.hits);
+    out.set("misses", (double)s.misses);
+    out.set("evictions", (double)s.evictions);
+    out.set("entries", (double)s.entries);
+    out.set("bytes", (double)s.bytes);
+    out.set("capacity", (double)s.capacity);
+    return out;
+}
+
+void set_cache_capacity(double bytes){
+    result_cache.set_capacity((size_t)max(bytes, 0.0));
+}
+
+void clear_cache(){
+    result_cache.clear();
+    result_cache.reset_stats();
+}
+
 EMSCRIPTEN_BINDINGS(metodos_numericos) {
     // registra vetores aninhados
     emscripten::register_vector<std::string>("VectorString");
@@ -116,6 +206,13 @@ EMSCRIPTEN_BINDINGS(metodos_numericos) {
     emscripten::register_vector<double>("VectorDouble");
 
     emscripten::function("comparative_boards", &quadro_comparativo);
+    emscripten::function("comparative_boards_numeric", &quadro_comparativo_numerico);
+    emscripten::function("set_function", &set_function);
+    emscripten::function("metrics_json", &metrics_json);
+    emscripten::function("reset_metrics", &metrics::reset);
+    emscripten::function("cache_stats", &cache_stats);
+    emscripten::function("set_cache_capacity", &set_cache_capacity);
+    emscripten::function("clear_cache", &clear_cache);
 }
 
 
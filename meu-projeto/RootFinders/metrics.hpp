@@ -0,0 +1,192 @@
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+/*
+Instrumentação dos métodos, agregada por método ao longo da execução: número de resoluções, quantas convergiram,
+barramentos inválidos, divisões por valores próximos de zero, avaliações de f, interações (total e histograma),
+e tempo de parede por resolução (total, mínimo e máximo). to_json() exporta tudo em JSON; o terminal escreve esse
+JSON com --metricas e o módulo WASM o expõe em metrics_json().
+
+A instrumentação só existe quando o código é compilado com RF_METRICS definido (opção ROOTFINDERS_METRICS do
+CMake). Sem ela, Scope e as funções de evento são vazias e inline, e os métodos compilam exatamente como antes.
+Os contadores são atômicos (relaxed), então métodos rodando em paralelo (quadro_comparativo_paralelo, modo em lote)
+podem registrar ao mesmo tempo.
+
+Uso dentro de um método:
+
+    metrics::Scope scope(metrics::BISECTION);
+    ...
+    return scope.done({x, k, true, ...});
+
+As versões em lote (batch_solvers.hpp, continuation.hpp) e o Newton constexpr de FixedPolynomial não são
+instrumentados: o primeiro não tem um tempo por resolução e o segundo precisa continuar avaliável em tempo de
+compilação.
+*/
+namespace metrics {
+
+enum Method {
+    BISECTION, FALSE_POSITION, BRENT, ILLINOIS, ITP, FIXED_POINT, FIXED_POINT_AITKEN, STEFFENSEN, ANDERSON,
+    NEWTON_RAPHSON, NEWTON_RAPHSON_AD, HALLEY, SECANT, POLYNOMIAL_NEWTON_RAPHSON, POLYNOMIAL_ALL_ROOTS, PORTFOLIO,
+    SYSTEM_NEWTON, SYSTEM_NEWTON_AD, SYSTEM_BROYDEN, METHOD_COUNT
+};
+
+const char* const METHOD_NAMES[METHOD_COUNT] = {
+    "bisection", "false_position", "brent", "illinois", "itp", "fixed_point", "fixed_point_aitken", "steffensen",
+    "anderson", "newton_raphson", "newton_raphson_ad", "halley", "secant", "polynomial_newton_raphson",
+    "polynomial_all_roots", "portfolio", "system_newton", "system_newton_ad", "system_broyden"
+};
+
+// Histograma de interações: a faixa 0 conta as resoluções com 0 interações e a faixa i >= 1 as com [2^(i-1), 2^i),
+// com a última acumulando todas as maiores
+const int HISTOGRAM_BUCKETS = 12;
+
+inline int histogram_bucket(int interations){
+    int bucket = 0;
+    while(interations > 0 && bucket < HISTOGRAM_BUCKETS - 1){
+        interations >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+#ifdef RF_METRICS
+
+constexpr bool enabled = true;
+
+struct MethodStats {
+    std::atomic<std::uint64_t> solves{0}, converged{0}, invalid_brackets{0}, near_zero_divisions{0};
+    std::atomic<std::uint64_t> function_evaluations{0}, interations{0};
+    std::atomic<std::uint64_t> time_ns{0}, min_ns{UINT64_MAX}, max_ns{0};
+    std::atomic<std::uint64_t> histogram[HISTOGRAM_BUCKETS] = {};
+};
+
+// Contadores globais (uma única instância por programa, mesmo com o header incluído em várias unidades)
+inline MethodStats& stats(Method m){
+    static MethodStats all[METHOD_COUNT];
+    return all[m];
+}
+
+// Mede o tempo desde a construção e registra o resultado em done()
+class Scope {
+public:
+    explicit Scope(Method m) : method_(m), start_(std::chrono::steady_clock::now()) {}
+
+    template <class R>
+    R done(R r) const {
+        std::uint64_t ns = (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_).count();
+        MethodStats& s = stats(method_);
+        s.solves.fetch_add(1, std::memory_order_relaxed);
+        s.converged.fetch_add(r.converged ? 1 : 0, std::memory_order_relaxed);
+        s.function_evaluations.fetch_add(r.function_evaluations, std::memory_order_relaxed);
+        s.interations.fetch_add(r.interations, std::memory_order_relaxed);
+        s.histogram[histogram_bucket(r.interations)].fetch_add(1, std::memory_order_relaxed);
+        s.time_ns.fetch_add(ns, std::memory_order_relaxed);
+        std::uint64_t cur = s.min_ns.load(std::memory_order_relaxed);
+        while(ns < cur && !s.min_ns.compare_exchange_weak(cur, ns, std::memory_order_relaxed)){}
+        cur = s.max_ns.load(std::memory_order_relaxed);
+        while(ns > cur && !s.max_ns.compare_exchange_weak(cur, ns, std::memory_order_relaxed)){}
+        return r;
+    }
+
+private:
+    Method method_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Barramento em que f(a) e f(b) têm o mesmo sinal (o método lança invalid_argument em seguida)
+inline void invalid_bracket(Method m){
+    stats(m).invalid_brackets.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Divisão prestes a ser feita por um denominador nulo ou subnormal (derivada, diferença f(xk) - f(xk-1), ...)
+inline void check_division(Method m, double denominator){
+    if(std::abs(denominator) < DBL_MIN){
+        stats(m).near_zero_divisions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+inline void reset(){
+    for(int m = 0; m < METHOD_COUNT; m++){
+        MethodStats& s = stats((Method)m);
+        s.solves = 0;
+        s.converged = 0;
+        s.invalid_brackets = 0;
+        s.near_zero_divisions = 0;
+        s.function_evaluations = 0;
+        s.interations = 0;
+        s.time_ns = 0;
+        s.min_ns = UINT64_MAX;
+        s.max_ns = 0;
+        for(auto& h: s.histogram){
+            h = 0;
+        }
+    }
+}
+
+#else
+
+constexpr bool enabled = false;
+
+class Scope {
+public:
+    explicit Scope(Method){}
+
+    template <class R>
+    R done(R r) const { return r; }
+};
+
+inline void invalid_bracket(Method){}
+inline void check_division(Method, double){}
+inline void reset(){}
+
+#endif
+
+/*
+Contadores em JSON, um objeto por método (todos os métodos aparecem, mesmo sem resoluções):
+
+    {"enabled": true, "methods": {"bisection": {"solves": 3, "converged": 3, "not_converged": 0,
+     "invalid_brackets": 0, "near_zero_divisions": 0, "function_evaluations": 60, "interations": 54,
+     "time_ns": {"total": 2100, "min": 600, "max": 800, "mean": 700}, "interations_histogram": [0, 0, ...]}, ...}}
+
+Sem RF_METRICS retorna {"enabled": false, "methods": {}}.
+*/
+inline std::string to_json(){
+    std::string json = enabled ? "{\"enabled\":true,\"methods\":{" : "{\"enabled\":false,\"methods\":{";
+#ifdef RF_METRICS
+    for(int m = 0; m < METHOD_COUNT; m++){
+        const MethodStats& s = stats((Method)m);
+        std::uint64_t solves = s.solves, converged = s.converged, total_ns = s.time_ns, min_ns = s.min_ns;
+        json += m ? ",\"" : "\"";
+        json += METHOD_NAMES[m];
+        json += "\":{\"solves\":" + std::to_string(solves);
+        json += ",\"converged\":" + std::to_string(converged);
+        json += ",\"not_converged\":" + std::to_string(solves - converged);
+        json += ",\"invalid_brackets\":" + std::to_string(s.invalid_brackets.load());
+        json += ",\"near_zero_divisions\":" + std::to_string(s.near_zero_divisions.load());
+        json += ",\"function_evaluations\":" + std::to_string(s.function_evaluations.load());
+        json += ",\"interations\":" + std::to_string(s.interations.load());
+        json += ",\"time_ns\":{\"total\":" + std::to_string(total_ns);
+        json += ",\"min\":" + std::to_string(solves ? min_ns : 0);
+        json += ",\"max\":" + std::to_string(s.max_ns.load());
+        json += ",\"mean\":" + std::to_string(solves ? total_ns / solves : 0);
+        json += "},\"interations_histogram\":[";
+        for(int b = 0; b < HISTOGRAM_BUCKETS; b++){
+            json += (b ? "," : "") + std::to_string(s.histogram[b].load());
+        }
+        json += "]}";
+    }
+#endif
+    return json + "}}";
+}
+
+} // namespace metrics
+
+#endif
@@ -0,0 +1,321 @@
+#define NAPI_VERSION 8
+#include <node_api.h>
+#include "numeric_boards.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/*
+Addon nativo (N-API) usado pelo processo principal do Electron no lugar do módulo WASM quando disponível. Exporta:
+
+    comparativeBoards(a_foguetes, epsilon, max_iter, trace, funcao, threads?) -> Promise<NumericBoards>
+    threads() -> número de threads usado por padrão (núcleos da máquina)
+    cacheStats() -> {hits, misses, evictions, entries, bytes, capacity}
+    setCacheCapacity(bytes), clearCache()
+
+comparativeBoards retorna o mesmo objeto que comparative_boards_numeric (numeric_boards.hpp, src/numericBoards.ts):
+{count, methods, doubleStride, intStride, traceStride, doubles, ints, trace}, com os arrays copiados para buffers
+do JS. A resolução roda fora da thread do JS (napi_async_work), dividida em blocos de valores de a entre as
+threads de um WorkStealingPool; cada bloco tem seu próprio TraceBuffer, concatenados no fim com os índices do
+histórico corrigidos. Uma expressão inválida rejeita a Promise com a mesma mensagem de set_function.
+
+Os resultados ficam entre as chamadas em um SharedResultCache (result_cache.hpp) do processo, compartilhado pelas
+threads, com a mesma chave e o mesmo limite padrão do cache do módulo WASM; cacheStats, setCacheCapacity e clearCache
+equivalem a cache_stats, set_cache_capacity e clear_cache de main.cpp.
+
+Como N-API tem ABI estável, o mesmo binário carrega no Node e no Electron. Compilação (a partir de RootFinders/):
+    cmake -S . -B build-native -DROOTFINDERS_NODE_ADDON=ON && cmake --build build-native --target native_addon
+*/
+
+struct TrabalhoQuadros {
+    napi_async_work trabalho = nullptr;
+    napi_deferred adiado = nullptr;
+
+    vector<double> a_foguetes;
+    double error;
+    int max_iter;
+    bool registrar_historico;
+    string funcao;
+    int n_threads;
+
+    vector<double> doubles;
+    vector<int> ints;
+    vector<TraceRecord> trace;
+    string erro;
+};
+
+static SharedResultCache cache_resultados;
+
+static int threads_padrao(){
+    return max(1u, thread::hardware_concurrency());
+}
+
+static void resolve_quadros(TrabalhoQuadros& t){
+    size_t n = t.a_foguetes.size();
+    t.doubles.assign(n*METODOS*DOUBLES_POR_METODO, 0);
+    t.ints.assign(n*METODOS*INTS_POR_METODO, 0);
+    if(n == 0){
+        return;
+    }
+
+    // Blocos pequenos o bastante para balancear a carga (Newton e Brent variam bastante com a). Cada thread resolve
+    // seus blocos em um TraceBuffer próprio, reservado uma única vez para o pior caso (max_iter + 1 registros por
+    // método), e só os registros usados são copiados para o histórico do bloco
+    int n_threads = max(1, min<int>(t.n_threads, (int)n));
+    size_t bloco = min<size_t>(1024, max<size_t>(1, n / (8*n_threads)));
+    size_t n_blocos = (n + bloco - 1) / bloco;
+    vector<TraceBuffer> buffers(t.registrar_historico ? n_threads : 0);
+    vector<vector<TraceRecord>> historicos(t.registrar_historico ? n_blocos : 0);
+
+    WorkStealingPool pool(n_threads);
+    pool.parallel_for(n_blocos, 1, [&](size_t b){
+        size_t inicio = b*bloco, fim = min(n, inicio + bloco);
+        TraceBuffer* trace = nullptr;
+        if(t.registrar_historico){
+            trace = &buffers[WorkStealingPool::thread_index()];
+            if(trace->capacity() == 0){
+                trace->reserve(bloco*METODOS*(t.max_iter + 1));
+            }
+            trace->clear();
+        }
+        for(size_t i = inicio; i < fim; i++){
+            resolve_quadro(t.a_foguetes[i], t.funcao, t.error, t.max_iter, trace,
+                           &t.doubles[i*METODOS*DOUBLES_POR_METODO], &t.ints[i*METODOS*INTS_POR_METODO],
+                           &cache_resultados);
+        }
+        if(trace){
+            historicos[b].assign(trace->data(), trace->data() + trace->size());
+        }
+    });
+
+    // Os índices do histórico escritos por resolve_quadro são relativos ao bloco
+    if(t.registrar_historico){
+        size_t total = 0;
+        for(const auto& h: historicos){
+            total += h.size();
+        }
+        t.trace.reserve(total);
+        for(size_t b = 0; b < n_blocos; b++){
+            size_t deslocamento = t.trace.size();
+            t.trace.insert(t.trace.end(), historicos[b].begin(), historicos[b].end());
+            vector<TraceRecord>().swap(historicos[b]);
+            for(size_t i = b*bloco; i < min(n, (b + 1)*bloco); i++){
+                for(int m = 0; m < METODOS; m++){
+                    t.ints[(i*METODOS + m)*INTS_POR_METODO + 3] += (int)deslocamento;
+                }
+            }
+        }
+    }
+}
+
+static void executa(napi_env, void* dados){
+    TrabalhoQuadros& t = *static_cast<TrabalhoQuadros*>(dados);
+    try{
+        resolve_quadros(t);
+    }catch(const exception& erro){
+        t.erro = erro.what();
+    }
+}
+
+// Copia bytes para um ArrayBuffer novo e retorna uma view tipada sobre ele (buffers externos não são permitidos
+// pelo Electron, então a cópia é necessária)
+static napi_value typed_array(napi_env env, napi_typedarray_type tipo, const void* dados, size_t n, size_t tamanho){
+    void* destino;
+    napi_value buffer, array;
+    napi_create_arraybuffer(env, n*tamanho, &destino, &buffer);
+    if(n){
+        memcpy(destino, dados, n*tamanho);
+    }
+    napi_create_typedarray(env, tipo, n, buffer, 0, &array);
+    return array;
+}
+
+static void define_inteiro(napi_env env, napi_value objeto, const char* nome, int64_t valor){
+    napi_value v;
+    napi_create_int64(env, valor, &v);
+    napi_set_named_property(env, objeto, nome, v);
+}
+
+static void completa(napi_env env, napi_status, void* dados){
+    TrabalhoQuadros* t = static_cast<TrabalhoQuadros*>(dados);
+    if(!t->erro.empty()){
+        napi_value mensagem, erro;
+        napi_create_string_utf8(env, t->erro.c_str(), t->erro.size(), &mensagem);
+        napi_create_error(env, nullptr, mensagem, &erro);
+        napi_reject_deferred(env, t->adiado, erro);
+    }else{
+        napi_value out, nomes;
+        napi_create_object(env, &out);
+        define_inteiro(env, out, "count", (int64_t)t->a_foguetes.size());
+        napi_create_array_with_length(env, METODOS, &nomes);
+        for(int m = 0; m < METODOS; m++){
+            napi_value nome;
+            napi_create_string_utf8(env, NOMES_METODOS[m], NAPI_AUTO_LENGTH, &nome);
+            napi_set_element(env, nomes, m, nome);
+        }
+        napi_set_named_property(env, out, "methods", nomes);
+        define_inteiro(env, out, "doubleStride", DOUBLES_POR_METODO);
+        define_inteiro(env, out, "intStride", INTS_POR_METODO);
+        define_inteiro(env, out, "traceStride", 4);
+        napi_set_named_property(env, out, "doubles", typed_array(env, napi_float64_array, t->doubles.data(), t->doubles.size(), sizeof(double)));
+        napi_set_named_property(env, out, "ints", typed_array(env, napi_int32_array, t->ints.data(), t->ints.size(), sizeof(int)));
+        napi_set_named_property(env, out, "trace", typed_array(env, napi_float64_array, t->trace.data(), 4*t->trace.size(), sizeof(double)));
+        napi_resolve_deferred(env, t->adiado, out);
+    }
+    if(t->trabalho){
+        napi_delete_async_work(env, t->trabalho);
+    }
+    delete t;
+}
+
+static napi_value lanca(napi_env env, const string& mensagem){
+    napi_throw_type_error(env, nullptr, mensagem.c_str());
+    return nullptr;
+}
+
+// Valores de a de um Float64Array ou de um Array de números
+static bool le_numeros(napi_env env, napi_value valor, vector<double>& saida){
+    bool typed, array;
+    napi_is_typedarray(env, valor, &typed);
+    if(typed){
+        napi_typedarray_type tipo;
+        size_t n;
+        void* dados;
+        napi_get_typedarray_info(env, valor, &tipo, &n, &dados, nullptr, nullptr);
+        if(tipo != napi_float64_array){
+            return false;
+        }
+        const double* d = static_cast<const double*>(dados);
+        saida.assign(d, d + n);
+        return true;
+    }
+    napi_is_array(env, valor, &array);
+    if(!array){
+        return false;
+    }
+    uint32_t n;
+    napi_get_array_length(env, valor, &n);
+    saida.resize(n);
+    for(uint32_t i = 0; i < n; i++){
+        napi_value elemento;
+        napi_get_element(env, valor, i, &elemento);
+        if(napi_get_value_double(env, elemento, &saida[i]) != napi_ok){
+            return false;
+        }
+    }
+    return true;
+}
+
+static napi_value comparative_boards(napi_env env, napi_callback_info info){
+    size_t argc = 6;
+    napi_value argv[6];
+    napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+    if(argc < 3){
+        return lanca(env, "comparativeBoards(a_foguetes, epsilon, max_iter, trace?, funcao?, threads?)");
+    }
+
+    TrabalhoQuadros* t = new TrabalhoQuadros();
+    int32_t n_threads = 0;
+    bool ok = le_numeros(env, argv[0], t->a_foguetes)
+        && napi_get_value_double(env, argv[1], &t->error) == napi_ok
+        && napi_get_value_int32(env, argv[2], &t->max_iter) == napi_ok;
+    t->registrar_historico = false;
+    if(ok && argc > 3){
+        ok = napi_get_value_bool(env, argv[3], &t->registrar_historico) == napi_ok;
+    }
+    if(ok && argc > 4){
+        size_t n;
+        ok = napi_get_value_string_utf8(env, argv[4], nullptr, 0, &n) == napi_ok;
+        if(ok){
+            t->funcao.resize(n + 1);
+            napi_get_value_string_utf8(env, argv[4], &t->funcao[0], n + 1, &n);
+            t->funcao.resize(n);
+        }
+    }
+    if(ok && argc > 5){
+        ok = napi_get_value_int32(env, argv[5], &n_threads) == napi_ok;
+    }
+    if(!ok){
+        delete t;
+        return lanca(env, "comparativeBoards: argumentos inválidos");
+    }
+    t->n_threads = n_threads > 0 ? n_threads : threads_padrao();
+
+    napi_value promessa;
+    napi_create_promise(env, &t->adiado, &promessa);
+
+    // Mesma validação de set_function (main.cpp), antes de ir para as threads
+    try{
+        if(!t->funcao.empty()){
+            ExpressionFamily validacao(t->funcao, "a", "d");
+        }
+    }catch(const invalid_argument& erro){
+        t->erro = erro.what();
+        completa(env, napi_ok, t);
+        return promessa;
+    }
+
+    napi_value nome;
+    napi_create_string_utf8(env, "comparativeBoards", NAPI_AUTO_LENGTH, &nome);
+    napi_create_async_work(env, nullptr, nome, executa, completa, t, &t->trabalho);
+    napi_queue_async_work(env, t->trabalho);
+    return promessa;
+}
+
+static napi_value threads(napi_env env, napi_callback_info){
+    napi_value v;
+    napi_create_int32(env, threads_padrao(), &v);
+    return v;
+}
+
+static napi_value cache_stats(napi_env env, napi_callback_info){
+    CacheStats s = cache_resultados.stats();
+    napi_value out;
+    napi_create_object(env, &out);
+    define_inteiro(env, out, "hits", (int64_t)s.hits);
+    define_inteiro(env, out, "misses", (int64_t)s.misses);
+    define_inteiro(env, out, "evictions", (int64_t)s.evictions);
+    define_inteiro(env, out, "entries", (int64_t)s.entries);
+    define_inteiro(env, out, "bytes", (int64_t)s.bytes);
+    define_inteiro(env, out, "capacity", (int64_t)s.capacity);
+    return out;
+}
+
+static napi_value set_cache_capacity(napi_env env, napi_callback_info info){
+    size_t argc = 1;
+    napi_value argv[1];
+    double bytes;
+    napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+    if(argc < 1 || napi_get_value_double(env, argv[0], &bytes) != napi_ok){
+        return lanca(env, "setCacheCapacity(bytes)");
+    }
+    cache_resultados.set_capacity((size_t)max(bytes, 0.0));
+    return nullptr;
+}
+
+// Esvazia o cache e zera os contadores
+static napi_value clear_cache(napi_env, napi_callback_info){
+    cache_resultados.clear();
+    cache_resultados.reset_stats();
+    return nullptr;
+}
+
+static napi_value init(napi_env env, napi_value exports){
+    napi_property_descriptor funcoes[] = {
+        {"comparativeBoards", nullptr, comparative_boards, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"threads", nullptr, threads, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"cacheStats", nullptr, cache_stats, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setCacheCapacity", nullptr, set_cache_capacity, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"clearCache", nullptr, clear_cache, nullptr, nullptr, nullptr, napi_default, nullptr},
+    };
+    napi_define_properties(env, exports, sizeof(funcoes)/sizeof(funcoes[0]), funcoes);
+    return exports;
+}
+
+NAPI_MODULE(rootfinders_native, init)
@@ -0,0 +1,152 @@
+#ifndef NUMERIC_BOARDS_HPP
+#define NUMERIC_BOARDS_HPP
+
+#include <cmath>
+#include <functional>
+#include <optional>
+#include <string>
+#include "root_finders.hpp"
+#include "generic_solvers.hpp"
+#include "expression.hpp"
+#include "result_cache.hpp"
+
+/*
+Quadros comparativos numéricos, compartilhados pelo módulo WASM (main.cpp) e pelo addon nativo do Electron
+(native_addon.cpp). Para o quadro i e o método m (0 = bissecção, 1 = posição falsa, 2 = Newton-Raphson, 3 = Brent):
+
+    doubles[(i*METODOS + m)*DOUBLES_POR_METODO + k], k = 0: A (ou x0), 1: B (NaN no Newton), 2: x, 3: |f(x)|, 4: erro
+    ints[(i*METODOS + m)*INTS_POR_METODO + k],       k = 0: convergiu (0/1), 1: interações, 2: avaliações de f,
+                                                     3: início do histórico em trace, 4: número de registros
+
+O histórico é um TraceBuffer lido como 4 doubles por registro (k, x, f(x), largura do intervalo ou passo).
+A função é fa(a) = ad - dln(d), ou uma expressão em a e d (expression.hpp) se funcao não for vazia.
+*/
+const int METODOS = 4;
+const int DOUBLES_POR_METODO = 5;
+const int INTS_POR_METODO = 5;
+const char* const NOMES_METODOS[METODOS] = {"Bissecção", "Posição Falsa", "Newton Raphson", "Brent"};
+static_assert(sizeof(TraceRecord) == 4*sizeof(double), "TraceRecord deve ser lido como 4 doubles contíguos");
+
+// fa(a) = ad - dln(d), escrita de forma genérica: em double dá f(d), em ad::Dual dá f(d) e f'(d) juntas
+inline auto foguete(double a){
+    return [a](auto d){ return a*d - d*log(d); };
+}
+
+// fa(a) como std::function, ou a expressão funcao (em a e d) com a = a se funcao não for vazia
+inline std::function<double(double)> fa(const std::string& funcao, double a){
+    if(!funcao.empty()){
+        return Expression(funcao, {"d"}, {{"a", a}});
+    }
+    return foguete(a);
+}
+
+// Newton-Raphson em fa(a) (ou na expressão funcao) a partir de x0, com a derivada obtida por diferenciação
+// automática ou simbolicamente
+inline Result newton_fa(const std::string& funcao, double a, double x0, double error, int max_iter, TraceBuffer* trace = nullptr){
+    if(!funcao.empty()){
+        Expression f(funcao, {"d"}, {{"a", a}});
+        return generic::newton_raphson(f, f.derivative(), x0, error, max_iter, false, trace);
+    }
+    return generic::newton_raphson_ad(foguete(a), x0, error, max_iter, false, trace);
+}
+
+inline void barramento(double a, double& a_barramento, double& b_barramento, double& x0){
+    /*A solução da equação ad - dln(d) é d = e^a,
+    seja [A,B] o barramento, então devemos ter A <= e^a e e^B >= e^b
+    para que seja possível a convergencia
+
+
+    Portanto, usaremos o barramento [2^a,3^a] se a > 0 e [3^a, 2^a] se a < 0
+
+    No caso do Newton-Raphson, podemos utilizar o valor inicial de x0 = 2.7^a, ja que é proximo do valor de e^a
+
+    */
+
+    a_barramento = a < 0 ?  pow((double)3, a) : pow((double)2, a);
+    b_barramento =  a < 0 ?  pow((double)2, a) : pow((double)3, a);
+    a_barramento = a == 0 ?  0.98 : a_barramento;
+    b_barramento =  a == 0 ?  1.02 : b_barramento;
+    x0 = pow((double)2.7, a);
+}
+
+inline void escreve_resultado(double* d, int* n, double dado_1, double dado_2, const Result& r, std::size_t inicio_historico, std::size_t fim_historico){
+    d[0] = dado_1;
+    d[1] = dado_2;
+    d[2] = r.root;
+    d[3] = r.residual;
+    d[4] = r.error;
+    n[0] = r.converged;
+    n[1] = r.interations;
+    n[2] = r.function_evaluations;
+    n[3] = (int)inicio_historico;
+    n[4] = (int)(fim_historico - inicio_historico);
+}
+
+template <class Cache = ResultCache>
+void resolve_quadro(double a, const std::string& funcao, double error, int max_iter, TraceBuffer* trace,
+                    double* doubles, int* ints, Cache* cache = nullptr){
+    /*
+    Resolve os quatro métodos para um valor de a e escreve a linha do quadro.
+
+    Args:
+        (double) a: Parâmetro da função
+        (const std::string&) funcao: Expressão em a e d (vazia para fa(a) = ad - dln(d))
+        (double) error: Tolerância
+        (int) max_iter: Número máximo de interações
+        (TraceBuffer*) trace: Buffer de histórico (nullptr se não for registrado); os índices escritos em ints
+            são relativos a ele
+        (double*) doubles: Início da linha do quadro, METODOS*DOUBLES_POR_METODO valores
+        (int*) ints: Início da linha do quadro, METODOS*INTS_POR_METODO valores
+        (Cache*) cache: Cache de resultados entre chamadas, ResultCache ou, com várias threads resolvendo ao mesmo
+            tempo, SharedResultCache (nullptr para sempre resolver)
+    */
+    double a_barramento, b_barramento, x0;
+    barramento(a, a_barramento, b_barramento, x0);
+
+    // f só é construída na primeira falta no cache. Os métodos de barramento só rodam se f troca de sinal em
+    // [A, B], o que pode não acontecer com uma expressão qualquer
+    auto resolve = [&](auto cria_f){
+        std::optional<decltype(cria_f())> f;
+        auto funcao_a = [&]() -> const auto& {
+            if(!f){
+                f.emplace(cria_f());
+            }
+            return *f;
+        };
+        std::optional<bool> sinais;
+        auto troca_sinal = [&]{
+            if(!sinais){
+                sinais = funcao_a()(a_barramento) * funcao_a()(b_barramento) < 0;
+            }
+            return *sinais;
+        };
+        Result invalido = {NAN, 0, false, NAN, NAN, 0};
+
+        auto metodo = [&](int m, double dado_1, double dado_2, auto&& run){
+            std::size_t inicio = trace ? trace->size() : 0;
+            Result r = cache ? cache->solve(CacheKey(funcao, a, error, max_iter, m), trace, run) : run(trace);
+            escreve_resultado(doubles + m*DOUBLES_POR_METODO, ints + m*INTS_POR_METODO, dado_1, dado_2, r,
+                              inicio, trace ? trace->size() : 0);
+        };
+        metodo(0, a_barramento, b_barramento, [&](TraceBuffer* t){
+            return troca_sinal() ? generic::bisection(funcao_a(), a_barramento, b_barramento, error, max_iter, false, t) : invalido;
+        });
+        metodo(1, a_barramento, b_barramento, [&](TraceBuffer* t){
+            return troca_sinal() ? generic::false_position(funcao_a(), a_barramento, b_barramento, error, max_iter, false, t) : invalido;
+        });
+        metodo(2, x0, NAN, [&](TraceBuffer* t){
+            return newton_fa(funcao, a, x0, error, max_iter, t);
+        });
+        metodo(3, a_barramento, b_barramento, [&](TraceBuffer* t){
+            return troca_sinal() ? generic::brent(funcao_a(), a_barramento, b_barramento, error, max_iter, false, t) : invalido;
+        });
+    };
+
+    if(funcao.empty()){
+        resolve([a]{ return foguete(a); });
+    }else{
+        resolve([&funcao, a]{ return Expression(funcao, {"d"}, {{"a", a}}); });
+    }
+}
+
+#endif
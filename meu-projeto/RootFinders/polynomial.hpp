@@ -0,0 +1,248 @@
+#ifndef POLYNOMIAL_HPP
+#define POLYNOMIAL_HPP
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+Polinômio p(x) = c[0]*x^n + c[1]*x^(n-1) + ... + c[n], com os coeficientes na mesma ordem usada por
+polynomial_newton_raphson (do maior para o menor grau). Os coeficientes de p'(x) são calculados uma única vez
+na construção, e a avaliação nunca aloca memória.
+
+Para graus baixos, p e p' são avaliados juntos em uma única passada de Horner. A partir de ESTRIN_MIN_DEGREE é
+usado o esquema de Estrin em blocos de 8 coeficientes: dentro de cada bloco as multiplicações são independentes
+entre si (o processador as executa em paralelo), e os blocos são combinados por Horner em x^8, o que encurta a
+cadeia de dependências de n para cerca de n/8 + 3 operações.
+*/
+class Polynomial {
+public:
+    static constexpr int ESTRIN_MIN_DEGREE = 16;
+
+    explicit Polynomial(std::vector<double> coeffs) : coeffs_(std::move(coeffs)){
+        // Coeficientes nulos de maior grau não alteram o polinômio
+        std::size_t first = 0;
+        while(first + 1 < coeffs_.size() && coeffs_[first] == 0){
+            first++;
+        }
+        coeffs_.erase(coeffs_.begin(), coeffs_.begin() + first);
+        if(coeffs_.empty()){
+            throw std::invalid_argument("Polinômio inválido: nenhum coeficiente fornecido!");
+        }
+        int n = degree();
+        for(int i = 0; i < n; i++){
+            dcoeffs_.push_back(coeffs_[i] * (n - i));
+        }
+        if(dcoeffs_.empty()){
+            dcoeffs_.push_back(0);
+        }
+        ascending_ = padded_ascending(coeffs_);
+        dascending_ = padded_ascending(dcoeffs_);
+    }
+
+    int degree() const { return (int)coeffs_.size() - 1; }
+    const std::vector<double>& coefficients() const { return coeffs_; }
+    const std::vector<double>& derivative_coefficients() const { return dcoeffs_; }
+
+    // p(x)
+    double operator()(double x) const {
+        if(degree() >= ESTRIN_MIN_DEGREE){
+            return estrin(ascending_, x);
+        }
+        return horner(coeffs_, x);
+    }
+
+    // p'(x)
+    double derivative(double x) const {
+        if(degree() >= ESTRIN_MIN_DEGREE){
+            return estrin(dascending_, x);
+        }
+        return horner(dcoeffs_, x);
+    }
+
+    // p(x) e p'(x) em uma única chamada
+    void eval(double x, double& p, double& dp) const {
+        if(degree() >= ESTRIN_MIN_DEGREE){
+            // As duas avaliações são independentes e se sobrepõem no pipeline
+            p = estrin(ascending_, x);
+            dp = estrin(dascending_, x);
+            return;
+        }
+        horner_fused(x, p, dp);
+    }
+
+    // p(z) e p'(z) para z complexo (usado pelo polynomial_all_roots), por Horner
+    void eval(std::complex<double> z, std::complex<double>& p, std::complex<double>& dp) const {
+        horner_fused(z, p, dp);
+    }
+
+private:
+    std::vector<double> coeffs_;     // Coeficientes de p, do maior para o menor grau
+    std::vector<double> dcoeffs_;    // Coeficientes de p', do maior para o menor grau
+    std::vector<double> ascending_;  // Coeficientes de p do menor para o maior grau, completados com zeros até múltiplo de 8
+    std::vector<double> dascending_; // Idem para p'
+
+    static std::vector<double> padded_ascending(const std::vector<double>& c){
+        std::vector<double> a(c.rbegin(), c.rend());
+        a.resize((a.size() + 7) / 8 * 8, 0.0);
+        return a;
+    }
+
+    static double horner(const std::vector<double>& c, double x){
+        double y = 0;
+        for(double ci: c){
+            y = ci + y*x;
+        }
+        return y;
+    }
+
+    // Horner para p e p' ao mesmo tempo: p' é acumulado a partir dos valores parciais de p
+    template <class T>
+    void horner_fused(T x, T& p, T& dp) const {
+        p = coeffs_[0];
+        dp = 0;
+        for(std::size_t i = 1; i < coeffs_.size(); i++){
+            dp = dp*x + p;
+            p = p*x + coeffs_[i];
+        }
+    }
+
+    static double estrin(const std::vector<double>& a, double x){
+        double x2 = x*x, x4 = x2*x2, x8 = x4*x4;
+        double y = 0;
+        for(std::size_t i = a.size(); i > 0; i -= 8){
+            const double* c = a.data() + i - 8;
+            double block = (c[0] + c[1]*x) + x2*(c[2] + c[3]*x)
+                         + x4*((c[4] + c[5]*x) + x2*(c[6] + c[7]*x));
+            y = y*x8 + block;
+        }
+        return y;
+    }
+};
+
+/*
+Polinômio de grau fixo N, conhecido em tempo de compilação, com os coeficientes em um std::array na mesma ordem de
+Polynomial (do maior para o menor grau). Todas as operações são constexpr: com coeficientes e x constantes, p(x), os
+coeficientes de p' e o Newton-Raphson de generic::polynomial_newton_raphson podem ser calculados pelo compilador.
+
+Como o número de coeficientes é constante, as passadas de Horner são desenroladas (fold expressions) e não há laço
+nem acesso a memória dinâmica. A partir de ESTRIN_MIN_DEGREE, p e p' são avaliados separadamente pelo esquema de
+Estrin, também desenrolado, cujas cadeias de dependência têm cerca de log2(N) operações em vez de N (até
+grau 16; acima disso os blocos de 8 são combinados sequencialmente). Para graus
+conhecidos apenas em tempo de execução, use Polynomial.
+
+    constexpr FixedPolynomial p(1.0, 0.0, -2.0, -5.0);   // x^3 - 2x - 5, grau deduzido dos argumentos
+    constexpr double y = p(2.0);                         // -1
+*/
+template <int N>
+class FixedPolynomial {
+    static_assert(N >= 0, "o grau deve ser não negativo");
+public:
+    static constexpr int ESTRIN_MIN_DEGREE = 6;
+    static constexpr int degree(){ return N; }
+
+    constexpr FixedPolynomial(const std::array<double, N + 1>& coeffs) : coeffs_(coeffs), dcoeffs_(){
+        for(int i = 0; i < N; i++){
+            dcoeffs_[i] = coeffs_[i] * (N - i);
+        }
+    }
+
+    template <class... T, class = std::enable_if_t<sizeof...(T) == N + 1>>
+    constexpr FixedPolynomial(T... coeffs) : FixedPolynomial(std::array<double, N + 1>{(double)coeffs...}) {}
+
+    constexpr const std::array<double, N + 1>& coefficients() const { return coeffs_; }
+
+    // Coeficientes de p', do maior para o menor grau (um único zero quando N = 0)
+    constexpr std::array<double, (N > 0 ? N : 1)> derivative_coefficients() const { return dcoeffs_; }
+
+    // p' como polinômio de grau N - 1
+    constexpr FixedPolynomial<(N > 0 ? N - 1 : 0)> derivative() const {
+        return FixedPolynomial<(N > 0 ? N - 1 : 0)>(dcoeffs_);
+    }
+
+    // p(x)
+    constexpr double operator()(double x) const {
+        if constexpr(N >= ESTRIN_MIN_DEGREE){
+            return estrin(coeffs_, x);
+        }else{
+            return horner(coeffs_, x, std::make_index_sequence<N + 1>());
+        }
+    }
+
+    // p'(x)
+    constexpr double derivative(double x) const {
+        if constexpr(N >= ESTRIN_MIN_DEGREE){
+            return estrin(dcoeffs_, x);
+        }else{
+            return horner(dcoeffs_, x, std::make_index_sequence<(N > 0 ? N : 1)>());
+        }
+    }
+
+    // p(x) e p'(x) em uma única chamada
+    constexpr void eval(double x, double& p, double& dp) const {
+        if constexpr(N >= ESTRIN_MIN_DEGREE){
+            p = estrin(coeffs_, x);
+            dp = estrin(dcoeffs_, x);
+        }else{
+            // Horner para p e p' ao mesmo tempo, como em Polynomial
+            p = coeffs_[0];
+            dp = 0;
+            horner_fused(x, p, dp, std::make_index_sequence<N>());
+        }
+    }
+
+    // Versão de tamanho dinâmico, para as funções que recebem Polynomial (polynomial_all_roots, etc.)
+    Polynomial dynamic() const {
+        return Polynomial(std::vector<double>(coeffs_.begin(), coeffs_.end()));
+    }
+
+private:
+    std::array<double, N + 1> coeffs_;
+    std::array<double, (N > 0 ? N : 1)> dcoeffs_;
+
+    template <std::size_t M, std::size_t... I>
+    static constexpr double horner(const std::array<double, M>& c, double x, std::index_sequence<I...>){
+        double y = 0;
+        ((y = y*x + c[I]), ...);
+        return y;
+    }
+
+    template <std::size_t... I>
+    constexpr void horner_fused(double x, double& p, double& dp, std::index_sequence<I...>) const {
+        ((dp = dp*x + p, p = p*x + coeffs_[I + 1]), ...);
+    }
+
+    // Estrin: o trecho de Len coeficientes a partir do grau Lo é dividido em c_baixo(x) + x^h * c_alto(x), com h a
+    // maior potência de 2 menor que Len, recursivamente. As metades são independentes e as potências x, x^2, x^4, ...
+    // são calculadas uma única vez. A recursão é resolvida em tempo de compilação
+    template <std::size_t M>
+    static constexpr double estrin(const std::array<double, M>& c, double x){
+        double powers[4] = {x, x*x, 0, 0};
+        powers[2] = powers[1]*powers[1];
+        powers[3] = powers[2]*powers[2];
+        return estrin_block<0, M>(c, x, powers);
+    }
+
+    // Soma de c[grau i] * x^(i - Lo) para i em [Lo, Lo + Len), com c em ordem decrescente de grau
+    template <std::size_t Lo, std::size_t Len, std::size_t M>
+    static constexpr double estrin_block(const std::array<double, M>& c, double x, const double* powers){
+        if constexpr(Len == 1){
+            return c[M - 1 - Lo];
+        }else if constexpr(Len == 2){
+            return c[M - 1 - Lo] + c[M - 2 - Lo]*x;
+        }else{
+            constexpr std::size_t h = Len > 8 ? 8 : Len > 4 ? 4 : 2;
+            constexpr int level = h == 8 ? 3 : h == 4 ? 2 : 1;
+            return estrin_block<Lo, h>(c, x, powers) + powers[level] * estrin_block<Lo + h, Len - h>(c, x, powers);
+        }
+    }
+};
+
+template <class... T>
+FixedPolynomial(T...) -> FixedPolynomial<(int)sizeof...(T) - 1>;
+
+#endif
@@ -0,0 +1,304 @@
+#ifndef PORTFOLIO_HPP
+#define PORTFOLIO_HPP
+
+#include "root_finders.hpp"
+#include "metrics.hpp"
+#include <cmath>
+#include <cfloat>
+
+/*
+Solver de portfólio: vários métodos correm intercalados na mesma thread, uma interação de cada por rodada, e o
+primeiro que chega a uma raíz certificada vence e encerra os outros. O custo fica perto do método mais rápido para
+cada entrada (vezes o número de membros ativos), e uma entrada que quebra um método (Newton a partir de um x0 ruim,
+f sem troca de sinal no barramento) é resolvida pelos outros.
+
+Certificação da raíz:
+    - bissecção: intervalo com troca de sinal de largura < epsilon
+    - Illinois: intervalo com troca de sinal de largura < epsilon, ou o critério dos métodos abertos
+    - Newton-Raphson e secante: passo |xk - xk-1| < epsilon e troca de sinal de f em [x - epsilon, x + epsilon]
+      (duas avaliações de f a mais)
+    - em todos, f(x) = 0
+Um membro cujo passo fica menor que epsilon sem a troca de sinal (uma raíz de multiplicidade par, por exemplo) sai
+da corrida como candidato não certificado.
+
+Membros que quebram saem da corrida sem afetar os outros:
+    - bissecção e Illinois sem troca de sinal em [a, b]
+    - Newton-Raphson com f'(x) nula ou não finita, passo ou f(x) não finitos, ou |f(x)| sem diminuir por
+      DIVERGENCE_ROUNDS interações seguidas
+    - secante com f(xk) = f(xk-1), valores não finitos ou a mesma divergência
+Se nenhum membro certifica, o resultado é o candidato não certificado (ou, sem candidatos, o membro ainda ativo) de
+menor |f(x)|, com certified = false.
+
+As interações custam de dezenas a centenas de nanossegundos, bem menos que sincronizar threads, por isso os membros
+são intercalados em vez de rodarem em threads separadas; o paralelismo vem de resolver valores de a diferentes ao
+mesmo tempo (como no modo em lote do terminal).
+*/
+namespace portfolio {
+
+enum Member { BISECTION, ILLINOIS, NEWTON_RAPHSON, SECANT, MEMBERS };
+const char* const MEMBER_NAMES[MEMBERS] = {"bisection", "illinois", "newton_raphson", "secant"};
+const unsigned ALL = (1u << MEMBERS) - 1;
+
+// Interações seguidas sem redução de |f(x)| após as quais Newton-Raphson e a secante são considerados divergentes
+const int DIVERGENCE_ROUNDS = 5;
+
+struct PortfolioResult {
+    Result result;    // Do vencedor (root, residual = |f(root)|, error = último passo ou largura do intervalo), com
+                      // converged = certified, interations = rodadas e function_evaluations = total de todos os membros
+    int winner;       // Índice em MEMBER_NAMES (-1 se nenhum membro produziu uma aproximação)
+    bool certified;
+    unsigned failed;  // Máscara (1 << membro) dos membros que quebraram
+};
+
+namespace detail {
+
+enum Status { IDLE, RUNNING, CERTIFIED, CANDIDATE, FAILED };
+
+struct Racer {
+    Status status = IDLE;
+    double x = NAN, fx = NAN, step = INFINITY;
+    double a = 0, b = 0, fa = 0, fb = 0;  // Barramento (bissecção e Illinois)
+    double xp = 0, fxp = 0;               // Aproximação anterior (secante)
+    int worse = 0;                        // Interações seguidas sem redução de |f(x)|
+    int evaluations = 0;
+};
+
+// Troca de sinal de f em [x - epsilon, x + epsilon]
+template <class F>
+bool verify(F& f, Racer& r, double epsilon){
+    if(r.fx == 0){
+        return true;
+    }
+    double lo = f(r.x - epsilon), hi = f(r.x + epsilon);
+    r.evaluations += 2;
+    return lo * hi <= 0;
+}
+
+// Aceita a nova aproximação de um método aberto, com as salvaguardas de valores não finitos e divergência
+template <class F>
+void open_step(F& f, Racer& r, double x, double fx, double epsilon){
+    if(!std::isfinite(x) || !std::isfinite(fx)){
+        r.status = FAILED;
+        return;
+    }
+    r.worse = std::abs(fx) < std::abs(r.fx) ? 0 : r.worse + 1;
+    r.step = std::abs(x - r.x);
+    r.x = x;
+    r.fx = fx;
+    if(r.fx == 0 || r.step < epsilon){
+        r.status = verify(f, r, epsilon) ? CERTIFIED : CANDIDATE;
+    }else if(r.worse >= DIVERGENCE_ROUNDS){
+        r.status = FAILED;
+    }
+}
+
+template <class F>
+void step_bisection(F& f, Racer& r, double epsilon){
+    double m = (r.a + r.b) / 2, fm = f(m);
+    r.evaluations++;
+    if(r.fa * fm < 0){
+        r.b = m;
+        r.fb = fm;
+    }else{
+        r.a = m;
+        r.fa = fm;
+    }
+    r.x = m;
+    r.fx = fm;
+    r.step = fm == 0 ? 0 : std::abs(r.b - r.a);
+    if(fm == 0 || r.step < epsilon){
+        r.status = CERTIFIED;
+    }
+}
+
+template <class F>
+void step_illinois(F& f, Racer& r, double epsilon){
+    double x = (r.a * r.fb - r.b * r.fa) / (r.fb - r.fa), fx = f(x);
+    r.evaluations++;
+    // b é sempre a aproximação mais recente; quando ela não troca de lado, f(a) é dividido por 2 (Illinois)
+    if(fx * r.fb < 0){
+        r.a = r.b;
+        r.fa = r.fb;
+    }else{
+        r.fa /= 2;
+    }
+    r.b = x;
+    r.fb = fx;
+    r.step = std::isfinite(r.x) ? std::abs(x - r.x) : INFINITY;
+    r.x = x;
+    r.fx = fx;
+    if(fx == 0 || std::abs(r.b - r.a) < epsilon){
+        r.step = std::min(r.step, std::abs(r.b - r.a));
+        r.status = CERTIFIED;
+    }else if(r.step < epsilon){
+        r.status = verify(f, r, epsilon) ? CERTIFIED : CANDIDATE;
+    }
+}
+
+template <class F, class DF>
+void step_newton(F& f, DF& df, Racer& r, double epsilon){
+    double d = df(r.x);
+    r.evaluations++;
+    metrics::check_division(metrics::PORTFOLIO, d);
+    if(!std::isfinite(d) || d == 0){
+        r.status = FAILED;
+        return;
+    }
+    double x = r.x - r.fx / d, fx = std::isfinite(x) ? f(x) : NAN;
+    r.evaluations += std::isfinite(x);
+    open_step(f, r, x, fx, epsilon);
+}
+
+template <class F>
+void step_secant(F& f, Racer& r, double epsilon){
+    double den = r.fx - r.fxp;
+    metrics::check_division(metrics::PORTFOLIO, den);
+    if(den == 0 || !std::isfinite(den)){
+        r.status = FAILED;
+        return;
+    }
+    double x = r.x - r.fx * (r.x - r.xp) / den, fx = std::isfinite(x) ? f(x) : NAN;
+    r.evaluations += std::isfinite(x);
+    r.xp = r.x;
+    r.fxp = r.fx;
+    open_step(f, r, x, fx, epsilon);
+}
+
+} // namespace detail
+
+template <class F, class DF>
+PortfolioResult solve(F&& f, DF&& df, double a, double b, double x0, double epsilon=1e-5, int max_inter=100, unsigned members=ALL){
+    /*
+    Resolve f(x) = 0 com os membros escolhidos correndo intercalados, até o primeiro certificar a raíz.
+
+    Args:
+        (F&&) f: Função f(x) a qual desejamos computar a raíz
+        (DF&&) df: Função f'(x), usada só pelo Newton-Raphson
+        (double) a, b: Barramento da bissecção e de Illinois (sem troca de sinal, os dois saem da corrida)
+        (double) x0: Aproximação inicial do Newton-Raphson e da secante (a secante parte de x0 e x0 + h, com h
+            relativo a x0, então seu primeiro passo é um Newton com derivada numérica)
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Número máximo de rodadas
+        (unsigned) members: Máscara (1 << membro) dos membros que correm (padrão: todos)
+
+    Returns:
+        (PortfolioResult): O resultado do vencedor, qual membro venceu e quais quebraram
+    */
+    using namespace detail;
+    metrics::Scope scope(metrics::PORTFOLIO);
+    Racer racers[MEMBERS];
+    int shared_evaluations = 0;
+
+    if(members & (1u << BISECTION | 1u << ILLINOIS)){
+        double fa = f(a), fb = f(b);
+        shared_evaluations += 2;
+        for(int m: {BISECTION, ILLINOIS}){
+            if(!(members & (1u << m))){
+                continue;
+            }
+            Racer& r = racers[m];
+            r.a = a;
+            r.b = b;
+            r.fa = fa;
+            r.fb = fb;
+            if(fa == 0 || fb == 0){
+                r.x = fa == 0 ? a : b;
+                r.fx = 0;
+                r.step = 0;
+                r.status = CERTIFIED;
+            }else{
+                r.status = fa * fb < 0 ? RUNNING : FAILED;
+            }
+        }
+    }
+    if(members & (1u << NEWTON_RAPHSON | 1u << SECANT)){
+        double fx0 = f(x0);
+        shared_evaluations++;
+        for(int m: {NEWTON_RAPHSON, SECANT}){
+            if(members & (1u << m)){
+                racers[m].x = x0;
+                racers[m].fx = fx0;
+                racers[m].status = std::isfinite(fx0) ? RUNNING : FAILED;
+            }
+        }
+        Racer& s = racers[SECANT];
+        if(s.status == RUNNING){
+            double h = std::sqrt(DBL_EPSILON) * (x0 != 0 ? std::abs(x0) : 1.0);
+            s.xp = x0;
+            s.fxp = fx0;
+            s.x = x0 + h;
+            s.fx = f(s.x);
+            s.evaluations++;
+            s.status = std::isfinite(s.fx) ? RUNNING : FAILED;
+        }
+    }
+
+    auto finish = [&](int winner, int rounds){
+        PortfolioResult out{{NAN, rounds, false, NAN, NAN, shared_evaluations}, winner, false, 0};
+        for(int m = 0; m < MEMBERS; m++){
+            out.result.function_evaluations += racers[m].evaluations;
+            if(racers[m].status == FAILED){
+                out.failed |= 1u << m;
+            }
+        }
+        if(winner >= 0){
+            const Racer& r = racers[winner];
+            out.certified = r.status == CERTIFIED;
+            out.result.root = r.x;
+            out.result.converged = out.certified;
+            out.result.residual = std::abs(r.fx);
+            out.result.error = r.step;
+        }
+        out.result = scope.done(out.result);
+        return out;
+    };
+
+    int rounds = 0;
+    for(int m = 0; m < MEMBERS; m++){
+        if(racers[m].status == CERTIFIED){
+            return finish(m, rounds);
+        }
+    }
+    while(rounds < max_inter){
+        rounds++;
+        bool active = false;
+        for(int m = 0; m < MEMBERS; m++){
+            Racer& r = racers[m];
+            if(r.status != RUNNING){
+                continue;
+            }
+            active = true;
+            switch(m){
+                case BISECTION: step_bisection(f, r, epsilon); break;
+                case ILLINOIS: step_illinois(f, r, epsilon); break;
+                case NEWTON_RAPHSON: step_newton(f, df, r, epsilon); break;
+                case SECANT: step_secant(f, r, epsilon); break;
+            }
+            if(r.status == CERTIFIED){
+                return finish(m, rounds);
+            }
+        }
+        if(!active){
+            break;
+        }
+    }
+
+    // Nenhum membro certificou: fica o candidato (ou, sem candidatos, o membro ativo) de menor |f(x)|
+    int best = -1;
+    for(Status wanted: {CANDIDATE, RUNNING}){
+        for(int m = 0; m < MEMBERS; m++){
+            const Racer& r = racers[m];
+            if(r.status == wanted && std::isfinite(r.fx) && (best < 0 || std::abs(r.fx) < std::abs(racers[best].fx))){
+                best = m;
+            }
+        }
+        if(best >= 0){
+            break;
+        }
+    }
+    return finish(best, rounds);
+}
+
+} // namespace portfolio
+
+#endif
@@ -0,0 +1,286 @@
+#ifndef RESULT_CACHE_HPP
+#define RESULT_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "root_finders.hpp"
+
+/*
+Cache de resultados entre chamadas, com limite de memória e descarte LRU (o resultado usado há mais tempo sai
+primeiro). A chave é (função, a, epsilon, max_iter, método): a função é a expressão de set_function (vazia para
+fa(a) = ad - dln(d)) e o método é um índice escolhido pelo chamador. a e epsilon são comparados bit a bit.
+
+Cada entrada guarda o Result e, se a resolução foi feita com histórico, os registros do TraceBuffer. Uma entrada
+sem histórico não serve a um pedido com histórico (é resolvida de novo e substituída).
+
+O módulo WASM mantém um cache por instância (um por Web Worker), de modo que adicionar ou remover um foguete
+resolve só os valores de a novos. ResultCache não é thread-safe; o addon nativo, que resolve os quadros em várias
+threads, usa um SharedResultCache.
+*/
+struct CacheKey {
+    std::string function;
+    std::uint64_t a_bits;
+    std::uint64_t epsilon_bits;
+    int max_inter;
+    int method;
+
+    CacheKey(std::string function, double a, double epsilon, int max_inter, int method)
+        : function(std::move(function)), a_bits(bits(a)), epsilon_bits(bits(epsilon)), max_inter(max_inter), method(method) {}
+
+    bool operator==(const CacheKey& o) const {
+        return a_bits == o.a_bits && epsilon_bits == o.epsilon_bits && max_inter == o.max_inter && method == o.method
+            && function == o.function;
+    }
+
+    static std::uint64_t bits(double x){
+        std::uint64_t u;
+        std::memcpy(&u, &x, sizeof u);
+        return u;
+    }
+};
+
+struct CacheKeyHash {
+    std::size_t operator()(const CacheKey& k) const {
+        std::uint64_t h = std::hash<std::string>()(k.function);
+        for(std::uint64_t v: {k.a_bits, k.epsilon_bits, (std::uint64_t)k.max_inter << 8 | (std::uint64_t)(unsigned)k.method}){
+            h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        }
+        return (std::size_t)h;
+    }
+};
+
+struct CacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+    std::size_t entries = 0;
+    std::size_t bytes = 0;    // Memória estimada das entradas (chaves, resultados, históricos e nós da lista/tabela)
+    std::size_t capacity = 0; // Limite de bytes
+};
+
+class ResultCache {
+public:
+    static const std::size_t DEFAULT_CAPACITY = 8u << 20;
+
+    explicit ResultCache(std::size_t capacity = DEFAULT_CAPACITY) : capacity_(capacity) {}
+
+    /*
+    Retorna o resultado de key, do cache ou de run(trace) se ele não estiver lá (ou não tiver o histórico pedido).
+
+    Args:
+        (const CacheKey&) key: Chave da resolução
+        (TraceBuffer*) trace: Buffer de histórico (nullptr se não for registrado). Num acerto, os registros
+            guardados são copiados para ele, como se o método tivesse rodado
+        (Run&&) run: Resolve de fato, Result run(TraceBuffer*)
+
+    Returns:
+        (Result): O mesmo Result que run retornaria
+    */
+    template <class Run>
+    Result solve(const CacheKey& key, TraceBuffer* trace, Run&& run){
+        Result r;
+        if(find(key, trace, r)){
+            return r;
+        }
+        std::size_t start = trace ? trace->size() : 0;
+        std::size_t dropped = trace ? trace->dropped() : 0;
+        r = run(trace);
+        store(key, r, trace, start, dropped);
+        return r;
+    }
+
+    // Primeira metade de solve: num acerto escreve o resultado em out, copia o histórico para trace e retorna true
+    bool find(const CacheKey& key, TraceBuffer* trace, Result& out){
+        auto it = index_.find(key);
+        if(it == index_.end() || (!it->second->has_trace && trace)){
+            stats_.misses++;
+            return false;
+        }
+        stats_.hits++;
+        order_.splice(order_.begin(), order_, it->second);
+        const Entry& e = *it->second;
+        if(trace){
+            for(const TraceRecord& t: e.trace){
+                trace->record((int)t.k, t.x, t.fx, t.width);
+            }
+        }
+        out = e.result;
+        return true;
+    }
+
+    // Segunda metade de solve: guarda r e os registros de trace a partir de start (dropped é trace->dropped() antes
+    // da resolução), substituindo uma entrada anterior de key
+    void store(const CacheKey& key, const Result& r, const TraceBuffer* trace, std::size_t start, std::size_t dropped){
+        // Histórico truncado pelo buffer cheio não é guardado: a entrada fica sem histórico
+        bool has_trace = trace && trace->dropped() == dropped;
+        std::vector<TraceRecord> records;
+        if(has_trace){
+            records.assign(trace->data() + start, trace->data() + trace->size());
+        }
+        auto it = index_.find(key);
+        if(it != index_.end()){
+            erase(it->second);
+        }
+        insert(key, r, std::move(records), has_trace);
+    }
+
+    // Troca o limite de memória, descartando as entradas mais antigas se necessário
+    void set_capacity(std::size_t capacity){
+        capacity_ = capacity;
+        evict();
+    }
+
+    void clear(){
+        order_.clear();
+        index_.clear();
+        stats_.bytes = 0;
+    }
+
+    void reset_stats(){
+        stats_.hits = stats_.misses = stats_.evictions = 0;
+    }
+
+    CacheStats stats() const {
+        CacheStats s = stats_;
+        s.entries = order_.size();
+        s.capacity = capacity_;
+        return s;
+    }
+
+private:
+    struct Entry {
+        CacheKey key;
+        Result result;
+        std::vector<TraceRecord> trace;
+        bool has_trace;
+        std::size_t bytes;
+    };
+
+    using Order = std::list<Entry>;
+
+    // A chave aparece duas vezes (na lista e na tabela), e cada nó custa por volta de dois ponteiros
+    static std::size_t entry_bytes(const Entry& e){
+        std::size_t function = e.key.function.capacity() > 15 ? e.key.function.capacity() + 1 : 0;
+        return sizeof(Entry) + sizeof(CacheKey) + 2*function + 6*sizeof(void*) + e.trace.size()*sizeof(TraceRecord);
+    }
+
+    void insert(const CacheKey& key, const Result& r, std::vector<TraceRecord> trace, bool has_trace){
+        order_.push_front({key, r, std::move(trace), has_trace, 0});
+        Entry& e = order_.front();
+        e.bytes = entry_bytes(e);
+        index_.emplace(key, order_.begin());
+        stats_.bytes += e.bytes;
+        evict();
+    }
+
+    void erase(Order::iterator it){
+        stats_.bytes -= it->bytes;
+        index_.erase(it->key);
+        order_.erase(it);
+    }
+
+    void evict(){
+        while(stats_.bytes > capacity_ && !order_.empty()){
+            erase(std::prev(order_.end()));
+            stats_.evictions++;
+        }
+    }
+
+    Order order_;
+    std::unordered_map<CacheKey, Order::iterator, CacheKeyHash> index_;
+    CacheStats stats_;
+    std::size_t capacity_;
+};
+
+/*
+Versão thread-safe de ResultCache para quem resolve em várias threads ao mesmo tempo (native_addon.cpp). As chaves
+são distribuídas pelo hash entre SHARDS caches independentes, cada um com seu mutex e 1/SHARDS da capacidade (o
+descarte LRU é por fatia). O mutex só é mantido durante a busca e a inserção: o método roda fora dele, então duas
+threads que erram a mesma chave ao mesmo tempo resolvem as duas e a última inserção fica.
+*/
+class SharedResultCache {
+public:
+    static const std::size_t SHARDS = 16;
+
+    explicit SharedResultCache(std::size_t capacity = ResultCache::DEFAULT_CAPACITY){
+        set_capacity(capacity);
+    }
+
+    // Mesmo contrato de ResultCache::solve
+    template <class Run>
+    Result solve(const CacheKey& key, TraceBuffer* trace, Run&& run){
+        Shard& shard = shard_of(key);
+        Result r;
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if(shard.cache.find(key, trace, r)){
+                return r;
+            }
+        }
+        std::size_t start = trace ? trace->size() : 0;
+        std::size_t dropped = trace ? trace->dropped() : 0;
+        r = run(trace);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.store(key, r, trace, start, dropped);
+        return r;
+    }
+
+    void set_capacity(std::size_t capacity){
+        for(Shard& shard: shards_){
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.cache.set_capacity(capacity / SHARDS);
+        }
+    }
+
+    void clear(){
+        for(Shard& shard: shards_){
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.cache.clear();
+        }
+    }
+
+    void reset_stats(){
+        for(Shard& shard: shards_){
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.cache.reset_stats();
+        }
+    }
+
+    // Soma das fatias (capacity é o limite total)
+    CacheStats stats(){
+        CacheStats total;
+        for(Shard& shard: shards_){
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            CacheStats s = shard.cache.stats();
+            total.hits += s.hits;
+            total.misses += s.misses;
+            total.evictions += s.evictions;
+            total.entries += s.entries;
+            total.bytes += s.bytes;
+            total.capacity += s.capacity;
+        }
+        return total;
+    }
+
+private:
+    struct Shard {
+        std::mutex mutex;
+        ResultCache cache;
+    };
+
+    Shard& shard_of(const CacheKey& key){
+        return shards_[(CacheKeyHash()(key) >> 8) % SHARDS];
+    }
+
+    Shard shards_[SHARDS];
+};
+
+#endif
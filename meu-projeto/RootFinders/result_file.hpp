@@ -0,0 +1,311 @@
+#ifndef RESULT_FILE_HPP
+#define RESULT_FILE_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "root_finders.hpp"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+Arquivo binário colunar de resultados (.rfc), para recarregar varreduras grandes sem reinterpretar texto e com a
+precisão completa dos doubles. Cada linha é um par (valor de a, método). O arquivo é um cabeçalho de
+RESULT_FILE_HEADER_SIZE bytes seguido de uma coluna contígua por campo:
+
+    a, root, residual, error           double   (8 bytes por linha)
+    interations, function_evaluations  int32    (4 bytes por linha)
+    method, converged                  uint8    (1 byte por linha; method indexa os nomes guardados no cabeçalho)
+
+O cabeçalho guarda o número de linhas, os nomes dos métodos e o deslocamento (alinhado em 8 bytes) de cada coluna, de
+modo que um leitor só precisa mapear o arquivo e apontar para as colunas: em C++ com ResultFile, no JS com
+Float64Array/Int32Array/Uint8Array sobre o ArrayBuffer (ver src/resultFile.ts). Os valores são little-endian.
+
+Layout do cabeçalho (offsets em bytes):
+    0    magic "RFCOLS\0\0"
+    8    uint32 versão (RESULT_FILE_VERSION)
+    12   uint32 número de métodos (até RESULT_FILE_MAX_METHODS)
+    16   uint64 número de linhas
+    24   uint64 deslocamento de cada uma das RESULT_FILE_COLUMNS colunas, na ordem de ResultColumn
+    88   nomes dos métodos, RESULT_FILE_NAME_SIZE bytes cada, terminados em '\0'
+*/
+const char RESULT_FILE_MAGIC[8] = {'R', 'F', 'C', 'O', 'L', 'S', 0, 0};
+const uint32_t RESULT_FILE_VERSION = 1;
+const size_t RESULT_FILE_HEADER_SIZE = 512;
+const size_t RESULT_FILE_MAX_METHODS = 16;
+const size_t RESULT_FILE_NAME_SIZE = 24;
+
+enum ResultColumn {
+    COL_A, COL_ROOT, COL_RESIDUAL, COL_ERROR, COL_INTERATIONS, COL_FUNCTION_EVALUATIONS, COL_METHOD, COL_CONVERGED,
+    RESULT_FILE_COLUMNS
+};
+
+// Bytes por linha de cada coluna, na ordem de ResultColumn
+const size_t RESULT_COLUMN_WIDTH[RESULT_FILE_COLUMNS] = {8, 8, 8, 8, 4, 4, 1, 1};
+
+struct ResultFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t n_methods;
+    uint64_t n_rows;
+    uint64_t offset[RESULT_FILE_COLUMNS];
+    char methods[RESULT_FILE_MAX_METHODS][RESULT_FILE_NAME_SIZE];
+};
+static_assert(sizeof(ResultFileHeader) <= RESULT_FILE_HEADER_SIZE, "cabeçalho maior que o espaço reservado");
+
+// Cabeçalho de um arquivo com n_rows linhas; file_size (opcional) recebe o tamanho total do arquivo
+inline ResultFileHeader result_file_header(uint64_t n_rows, const std::vector<std::string>& methods, uint64_t* file_size = nullptr){
+    ResultFileHeader header;
+    std::memset(&header, 0, sizeof header);
+    std::memcpy(header.magic, RESULT_FILE_MAGIC, sizeof header.magic);
+    header.version = RESULT_FILE_VERSION;
+    header.n_methods = (uint32_t)methods.size();
+    header.n_rows = n_rows;
+    uint64_t offset = RESULT_FILE_HEADER_SIZE;
+    for(int c = 0; c < RESULT_FILE_COLUMNS; c++){
+        header.offset[c] = offset;
+        offset += (n_rows * RESULT_COLUMN_WIDTH[c] + 7) / 8 * 8;
+    }
+    for(size_t m = 0; m < methods.size() && m < RESULT_FILE_MAX_METHODS; m++){
+        std::strncpy(header.methods[m], methods[m].c_str(), RESULT_FILE_NAME_SIZE - 1);
+    }
+    if(file_size){
+        *file_size = offset;
+    }
+    return header;
+}
+
+/*
+Escrita em fluxo: cada coluna é acumulada num arquivo temporário próprio (tmpfile) conforme as linhas chegam, e
+close() escreve o cabeçalho e copia as colunas para o arquivo final em blocos grandes. A memória usada não depende do
+número de linhas, então serve tanto para o quadro interativo quanto para o modo em lote do terminal.
+
+Args:
+    path: arquivo de saída (criado ou sobrescrito em close())
+    methods: nomes dos métodos; as linhas indicam o método pelo índice nesse vetor
+
+Lança runtime_error se os arquivos não puderem ser criados ou escritos.
+*/
+class ResultFileWriter {
+public:
+    ResultFileWriter(const std::string& path, const std::vector<std::string>& methods)
+        : path_(path), methods_(methods) {
+        if(methods_.size() > RESULT_FILE_MAX_METHODS){
+            throw std::runtime_error("Métodos demais para o arquivo de resultados");
+        }
+        for(auto& c: columns_){
+            c = std::tmpfile();
+            if(!c){
+                close_columns();
+                throw std::runtime_error("Não foi possível criar os arquivos temporários de " + path_);
+            }
+            std::setvbuf(c, nullptr, _IOFBF, 1 << 16);
+        }
+    }
+
+    ResultFileWriter(const ResultFileWriter&) = delete;
+    ResultFileWriter& operator=(const ResultFileWriter&) = delete;
+
+    ~ResultFileWriter(){
+        close_columns();
+    }
+
+    void append(double a, int method, const Result& r){
+        const int32_t interations = r.interations, evaluations = r.function_evaluations;
+        const uint8_t m = (uint8_t)method, converged = r.converged;
+        std::fwrite(&a, 8, 1, columns_[COL_A]);
+        std::fwrite(&r.root, 8, 1, columns_[COL_ROOT]);
+        std::fwrite(&r.residual, 8, 1, columns_[COL_RESIDUAL]);
+        std::fwrite(&r.error, 8, 1, columns_[COL_ERROR]);
+        std::fwrite(&interations, 4, 1, columns_[COL_INTERATIONS]);
+        std::fwrite(&evaluations, 4, 1, columns_[COL_FUNCTION_EVALUATIONS]);
+        std::fwrite(&m, 1, 1, columns_[COL_METHOD]);
+        std::fwrite(&converged, 1, 1, columns_[COL_CONVERGED]);
+        n_rows_++;
+    }
+
+    size_t size() const { return n_rows_; }
+
+    void close(){
+        if(closed_){
+            return;
+        }
+        closed_ = true;
+
+        ResultFileHeader header = result_file_header(n_rows_, methods_);
+
+        FILE* out = std::fopen(path_.c_str(), "wb");
+        if(!out){
+            close_columns();
+            throw std::runtime_error("Não foi possível criar " + path_);
+        }
+        char padding[RESULT_FILE_HEADER_SIZE] = {};
+        bool ok = std::fwrite(&header, sizeof header, 1, out) == 1
+            && std::fwrite(padding, 1, RESULT_FILE_HEADER_SIZE - sizeof header, out) == RESULT_FILE_HEADER_SIZE - sizeof header;
+
+        std::vector<char> buffer(1 << 20);
+        for(int c = 0; c < RESULT_FILE_COLUMNS && ok; c++){
+            FILE* column = columns_[c];
+            ok = std::fflush(column) == 0 && std::fseek(column, 0, SEEK_SET) == 0;
+            size_t n;
+            while(ok && (n = std::fread(buffer.data(), 1, buffer.size(), column)) > 0){
+                ok = std::fwrite(buffer.data(), 1, n, out) == n;
+            }
+            size_t bytes = n_rows_ * RESULT_COLUMN_WIDTH[c];
+            size_t pad = (bytes + 7) / 8 * 8 - bytes;
+            ok = ok && std::fwrite(padding, 1, pad, out) == pad;
+        }
+        ok = std::fclose(out) == 0 && ok;
+        close_columns();
+        if(!ok){
+            throw std::runtime_error("Erro ao escrever " + path_);
+        }
+    }
+
+private:
+    std::string path_;
+    std::vector<std::string> methods_;
+    FILE* columns_[RESULT_FILE_COLUMNS] = {};
+    uint64_t n_rows_ = 0;
+    bool closed_ = false;
+
+    void close_columns(){
+        for(auto& c: columns_){
+            if(c){
+                std::fclose(c);
+                c = nullptr;
+            }
+        }
+    }
+};
+
+/*
+Leitura por mapeamento em memória (mmap, ou MapViewOfFile no Windows): o construtor só valida o cabeçalho e os
+tamanhos, e as colunas são ponteiros para dentro do arquivo mapeado, sem cópia nem conversão. Os ponteiros valem
+enquanto o ResultFile existir.
+
+Args:
+    path: arquivo escrito por ResultFileWriter
+
+Lança runtime_error se o arquivo não existir, não for um arquivo de resultados ou estiver truncado.
+*/
+class ResultFile {
+public:
+    explicit ResultFile(const std::string& path){
+#ifdef _WIN32
+        file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(file_ == INVALID_HANDLE_VALUE){
+            throw std::runtime_error("Não foi possível abrir " + path);
+        }
+        LARGE_INTEGER size;
+        GetFileSizeEx(file_, &size);
+        size_ = (size_t)size.QuadPart;
+        if(size_ > 0){
+            mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            data_ = mapping_ ? (const char*)MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        }
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0){
+            throw std::runtime_error("Não foi possível abrir " + path);
+        }
+        struct stat st;
+        if(fstat(fd, &st) == 0 && st.st_size > 0){
+            size_ = (size_t)st.st_size;
+            void* p = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            data_ = p == MAP_FAILED ? nullptr : (const char*)p;
+        }
+        ::close(fd);
+#endif
+        if(!data_ || size_ < RESULT_FILE_HEADER_SIZE){
+            unmap();
+            throw std::runtime_error(path + " não é um arquivo de resultados");
+        }
+        header_ = (const ResultFileHeader*)data_;
+        if(std::memcmp(header_->magic, RESULT_FILE_MAGIC, sizeof header_->magic) != 0
+            || header_->version != RESULT_FILE_VERSION || header_->n_methods > RESULT_FILE_MAX_METHODS){
+            unmap();
+            throw std::runtime_error(path + " não é um arquivo de resultados (versão " + std::to_string(RESULT_FILE_VERSION) + ")");
+        }
+        for(int c = 0; c < RESULT_FILE_COLUMNS; c++){
+            if(header_->offset[c] % 8 != 0 || header_->offset[c] > size_
+                || header_->n_rows > (size_ - header_->offset[c]) / RESULT_COLUMN_WIDTH[c]){
+                unmap();
+                throw std::runtime_error(path + " está truncado");
+            }
+        }
+    }
+
+    ResultFile(const ResultFile&) = delete;
+    ResultFile& operator=(const ResultFile&) = delete;
+
+    ~ResultFile(){
+        unmap();
+    }
+
+    size_t size() const { return header_->n_rows; }
+
+    std::vector<std::string> methods() const {
+        std::vector<std::string> names;
+        for(uint32_t m = 0; m < header_->n_methods; m++){
+            names.emplace_back(header_->methods[m], strnlen(header_->methods[m], RESULT_FILE_NAME_SIZE));
+        }
+        return names;
+    }
+
+    const double* a() const { return column<double>(COL_A); }
+    const double* root() const { return column<double>(COL_ROOT); }
+    const double* residual() const { return column<double>(COL_RESIDUAL); }
+    const double* error() const { return column<double>(COL_ERROR); }
+    const int32_t* interations() const { return column<int32_t>(COL_INTERATIONS); }
+    const int32_t* function_evaluations() const { return column<int32_t>(COL_FUNCTION_EVALUATIONS); }
+    const uint8_t* method() const { return column<uint8_t>(COL_METHOD); }
+    const uint8_t* converged() const { return column<uint8_t>(COL_CONVERGED); }
+
+    // Linha i como Result
+    Result result(size_t i) const {
+        return {root()[i], interations()[i], converged()[i] != 0, residual()[i], error()[i], function_evaluations()[i]};
+    }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    const ResultFileHeader* header_ = nullptr;
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#endif
+
+    template <class T>
+    const T* column(ResultColumn c) const {
+        return (const T*)(data_ + header_->offset[c]);
+    }
+
+    void unmap(){
+#ifdef _WIN32
+        if(data_) UnmapViewOfFile(data_);
+        if(mapping_) CloseHandle(mapping_);
+        if(file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+        mapping_ = nullptr;
+        file_ = INVALID_HANDLE_VALUE;
+#else
+        if(data_) munmap((void*)data_, size_);
+#endif
+        data_ = nullptr;
+    }
+};
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef ROCKET_FAMILY_HPP
+#define ROCKET_FAMILY_HPP
+
+#include "simd.hpp"
+#include <cmath>
+
+/*
+Família de funções do problema dos foguetes, f_a(d) = a*d - d*ln(d), cuja raiz positiva é d = e^a.
+Escrita de forma genérica no tipo V para ser avaliada tanto com double (métodos escalares) quanto com
+simd::vdouble (métodos em lote de batch_solvers.hpp), onde cada lane carrega um valor de a diferente.
+*/
+struct RocketFamily {
+    // f_a(d)
+    template <class V>
+    V f(V a, V d) const {
+        using std::log;
+        using simd::log;
+        return a*d - d*log(d);
+    }
+
+    // d/dd f_a(d)
+    template <class V>
+    V df(V a, V d) const {
+        using std::log;
+        using simd::log;
+        return a - log(d) - 1.0;
+    }
+
+    // d/da f_a(d), usada pelo preditor das varreduras de continuation.hpp (dd/da = -(df/da)/(df/dd))
+    template <class V>
+    V dfda(V /*a*/, V d) const {
+        return d;
+    }
+};
+
+#endif
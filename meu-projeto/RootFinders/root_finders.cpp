@@ -1,187 +1,205 @@
 #include "root_finders.hpp"
+#include "generic_solvers.hpp"
 #include <cmath>
+#include <cfloat>
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 
-// Métodos de Horner para cálculo de polinômios e suas derivadas
+Result bisection(const std::function<double(double)>& f, double a, double b, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return generic::bisection(f, a, b, epsilon, max_inter, verbose, trace);
+}
 
-double eval_polynomial(const std::vector<double>& coeffs, double x);
+Result false_position(const std::function<double(double)>& f, double a, double b, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return generic::false_position(f, a, b, epsilon, max_inter, verbose, trace);
+}
 
-double eval_derivative_polynomial(const std::vector<double>& coeffs, double x);
+Result brent(const std::function<double(double)>& f, double a, double b, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return generic::brent(f, a, b, epsilon, max_inter, verbose, trace);
+}
 
-Result bisection(const std::function<double(double)>& f, double a, double b, double epsilon, int max_inter, bool verbose){
-    double x;
-    // Checagem se o intervalo fornecido é válido
-    if(f(a) * f(b) >= 0){
-        throw std::invalid_argument("Intervalo inválido: f(a) e f(b) possuem o mesmo sinal!");
-    }
-    // Imprimir quantidade mínima de interações estimada
-    if(verbose){
-        int min_inter = std::ceil((std::log10(b-a) - std::log10(epsilon))/std::log10(2));
-        std::cout << "Dado o intervalo I = [" << a << "," << b << "], precisão e = " << epsilon << ", o método irá convergir depois de " << min_inter << " passos de iteração.\n";  
-    } 
-    for(int k = 1; k <= max_inter; k++){
-        x = 0.5 * (a+b);
-        if(verbose){
-            std::cout << "========== Iteração " << k << " ==========\n";
-            std::cout << "I = [" << a << ", " << b << "]\n";
-            std::cout << "f(a) = " << f(a) << "\n";
-            std::cout << "f(b) = " << f(b) << "\n";
-            std::cout << "x = " << x << "\n";
-            std::cout << "f(x) = " << f(x) << "\n\n";
-        }
-        if((b - a) < epsilon){
-            return {x, k, true, std::abs(f(x)), std::abs(b-a)};
-        }
-        // Escolha dos extremos do intervalo da próxima interação
-        if(f(x) * f(a) > 0){
-            // se f(x) e f(a) possuem o mesmo sinal
-            a = x;
-            
-        }else{
-            b = x;
-        }
-    }
-    return {x, max_inter, false, std::abs(f(x)), std::abs(b-a)};
+Result illinois(const std::function<double(double)>& f, double a, double b, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return generic::illinois(f, a, b, epsilon, max_inter, verbose, trace);
 }
 
-Result false_position(const std::function<double(double)>& f, double a, double b, double epsilon, int max_inter, bool verbose){
-    double x;
-    double x0 = a;
-    // Checagem se o intervalo fornecido é válido
-    if(f(a) * f(b) >= 0){
-        throw std::invalid_argument("Intervalo inválido: f(a) e f(b) possuem o mesmo sinal!");
-    }
-    for(int k = 1; k <= max_inter; k++){
-        x = (a*f(b) - b*f(a))/(f(b) - f(a));
-        if(verbose){
-            std::cout << "========== Iteração " << k << " ==========\n";
-            std::cout << "I = [" << a << ", " << b << "]\n";
-            std::cout << "f(a) = " << f(a) << "\n";
-            std::cout << "f(b) = " << f(b) << "\n";
-            std::cout << "x = " << x << "\n";
-            std::cout << "f(x) = " << f(x) << "\n\n";
-        }
+Result itp(const std::function<double(double)>& f, double a, double b, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return generic::itp(f, a, b, epsilon, max_inter, verbose, trace);
+}
 
-        if(std::abs(b - a) < epsilon){
-            return {x, k, true, std::abs(f(x)), std::abs(b-a)};
-        }
+Result fixed_point(const std::function<double(double)>& phi, double x0, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return generic::fixed_point(phi, x0, epsilon, max_inter, verbose, trace);
+}
 
-        // Escolha dos extremos do intervalo da próxima interação
-        if(f(x) * f(a) > 0){
-            // se f(x) e f(a) possuem o mesmo sinal
-            a = x;
-        }else{
-            b = x;
-        }
+Result fixed_point_aitken(const std::function<double(double)>& phi, double x0, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return generic::fixed_point_aitken(phi, x0, epsilon, max_inter, verbose, trace);
+}
 
-        //Criterio de parada baseado na diferença entre o resultado anterior e o resultado atual
+Result steffensen(const std::function<double(double)>& phi, double x0, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return generic::steffensen(phi, x0, epsilon, max_inter, verbose, trace);
+}
 
-        if(std::abs(f(x)) < epsilon){
-            return {x, k, true, std::abs(f(x)), std::abs(f(x))};
-        }
-        //Mas ele não é justo, o valor real pode estar fora deste intervalo de erro.... pode?
+Result anderson(const std::function<double(double)>& phi, double x0, double epsilon, int max_inter, bool verbose, TraceBuffer* trace, int window){
+    return generic::anderson(phi, x0, epsilon, max_inter, verbose, trace, window);
+}
 
-        x0 = x;
-        
-    }
-    return {x, max_inter, false, std::abs(f(x)), std::abs(b-a)};
+Result newton_raphson(const std::function<double(double)>& f, const std::function<double(double)>& df, double x0, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return generic::newton_raphson(f, df, x0, epsilon, max_inter, verbose, trace);
 }
 
-Result fixed_point(const std::function<double(double)>& phi, double x0, double epsilon, int max_inter, bool verbose){
-    double x1;
-    for(int k = 0; k <= max_inter; k++){
-        x1 = phi(x0);
-        if(verbose){
-            std::cout << "========== Iteração " << k << " ==========\n";
-            std::cout << "x = " << x0 << "\n";
-            std::cout << "phi(x) = " << x1 << "\n\n";  
-        }
-        // Verificação do critério de parada |xk - xk-1| < epsilon 
-        if(std::abs(x1 - x0) < epsilon){
-            return {x1, k, true, -1};
-        }
-        x0 = x1;
-    }
-    return {x1, max_inter, false, -1};
+Result newton_raphson_ad(const std::function<ad::Dual(ad::Dual)>& f, double x0, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return generic::newton_raphson_ad(f, x0, epsilon, max_inter, verbose, trace);
+}
+
+Result halley(const std::function<ad::Dual2(ad::Dual2)>& f, double x0, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return generic::halley(f, x0, epsilon, max_inter, verbose, trace);
+}
+
+Result secant(const std::function<double(double)>& f, double x0, double x1, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return generic::secant(f, x0, x1, epsilon, max_inter, verbose, trace);
+}
+
+Result polynomial_newton_raphson(const std::vector<double>& coeffs, double x0, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    return polynomial_newton_raphson(Polynomial(coeffs), x0, epsilon, max_inter, verbose, trace);
 }
 
-Result newton_raphson(const std::function<double(double)>& f, const std::function<double(double)>& df, double x0, double epsilon, int max_inter, bool verbose){
-    double x;
-    for(int k = 1; k <= max_inter; k++){
-        x = x0 - f(x0)/df(x0); // xk = xk-1 - f(xk-1)/f'(xk-1)
+Result polynomial_newton_raphson(const Polynomial& p, double x0, double epsilon, int max_inter, bool verbose, TraceBuffer* trace){
+    metrics::Scope scope(metrics::POLYNOMIAL_NEWTON_RAPHSON);
+    double x = x0, step = 0;
+    // p(xk) e p'(xk) são calculados juntos e reaproveitados como p(xk-1) e p'(xk-1) na iteração seguinte
+    double px0, dpx0;
+    p.eval(x0, px0, dpx0);
+    double px = px0, dpx = dpx0;
+    int evaluations = 2;
+    for(int k = 0; k <= max_inter; k++){
+        metrics::check_division(metrics::POLYNOMIAL_NEWTON_RAPHSON, dpx0);
+        x = x0 - px0/dpx0; // xk = xk-1 - p(xk-1)/p'(xk-1)
+        // Salvaguarda (a mesma de newton_raphson): com p'(xk-1) nula o passo não é finito e o método para sem
+        // convergência, na última aproximação finita
+        if(dpx0 == 0 || !std::isfinite(x)){
+            return scope.done(Result{x0, k, false, std::abs(px0), INFINITY, evaluations});
+        }
+        p.eval(x, px, dpx);
+        evaluations += 2;
+        step = std::abs(x - x0);
         if(verbose){
             std::cout << "========== Iteração " << k << " ==========\n";
             std::cout << "x = " << x << "\n";
-            std::cout << "f(x) = " << f(x) << "\n";
-            std::cout << "f'(x) = " << df(x) << "\n\n";           
+            std::cout << "p(x) = " << px << "\n";
+            std::cout << "p'(x_anterior) = " << dpx0 << "\n\n";
+        }
+        if(trace){
+            trace->record(k, x, px, step);
         }
         // Verificação do critério de parada |xk - xk-1| < epsilon 
-        if(std::abs(x - x0) < epsilon){
-            return {x, k, true, std::abs(f(x)), std::abs(x - x0)};
+        if(step < epsilon){
+            return scope.done(Result{x, k, true, std::abs(px), step, evaluations});
         }
         x0 = x;
+        px0 = px;
+        dpx0 = dpx;
     }
-    return {x, max_inter, false, std::abs(f(x)), std::abs(x-x0)};
+    return scope.done(Result{x, max_inter, false, std::abs(px), step, evaluations});
 }
 
-Result secant(const std::function<double(double)>& f, double x0, double x1, double epsilon, int max_inter, bool verbose){
-    double aux;
-    for(int k = 0; k <= max_inter; k++){
-        // Checagem se f(x1) e f(x0) são iguais na interação k -> Evitar divisão por zero!
-        if((f(x1) - f(x0)) == 0){
-            std::cout << "Etapa de refinamento interrompida! Valores f(xk) e f(xk-1) muito próximos, possível ocorrência de divisão por zero!\n";
-            return {x1, k, true, std::abs(f(x1)), std::abs(x1-x0)};
-        }
-        if(verbose){
-            std::cout << "========== Iteração " << k << " ==========\n";
-            std::cout << "x0 = " << x0 << "\n";
-            std::cout << "x1 = " << x1 << "\n";
-            std::cout << "f(x0) = " << f(x0) << "\n";
-            std::cout << "f(x1) = " << f(x1) << "\n\n";
-        }
-        // Verificação do critério de parada |xk - xk-1| < epsilon 
-        if(std::abs(x1 - x0) < epsilon){
-            return {x1, k, true, std::abs(f(x1)), std::abs(x1-x0)};
-        }
-        aux = (x0 * f(x1) - x1*f(x0))/(f(x1) - f(x0));
-        x0 = x1;
-        x1 = aux;
+AllRootsResult polynomial_all_roots(const Polynomial& p, double epsilon, int max_inter, bool verbose){
+    metrics::Scope scope(metrics::POLYNOMIAL_ALL_ROOTS);
+    using complex = std::complex<double>;
+    const std::vector<double>& c = p.coefficients();
+    int n = p.degree();
+
+    // Deflação das raízes nulas: p(x) = x^zeros * q(x)
+    int zeros = 0;
+    while(zeros < n && c[n - zeros] == 0){
+        zeros++;
+    }
+    int m = n - zeros;
+    Polynomial q(std::vector<double>(c.begin(), c.end() - zeros));
+
+    // Aproximações iniciais em um círculo de raio igual à cota de Fujiwara para o módulo das raízes de q
+    double radius = 0;
+    for(int k = 1; k <= m; k++){
+        double ratio = std::abs(c[k] / c[0]) / (k == m ? 2.0 : 1.0);
+        radius = std::max(radius, std::pow(ratio, 1.0 / k));
+    }
+    radius = radius > 0 ? 2 * radius : 1;
+    std::vector<complex> z(m), delta(m);
+    std::vector<double> step(m, 0);
+    std::vector<char> active(m, 1), settled(m, 0), nudged(m, 0);
+    const double pi = 3.14159265358979323846;
+    for(int i = 0; i < m; i++){
+        // O deslocamento de 0.4 rad evita começar exatamente sobre o eixo real
+        z[i] = std::polar(radius, 2 * pi * i / m + 0.4);
     }
-    return {x1, max_inter, false, std::abs(f(x1))};
-}
 
-Result polynomial_newton_raphson(const std::vector<double>& coeffs, double x0, double epsilon, int max_inter, bool verbose){
-    double x;
-    for(int k = 0; k <= max_inter; k++){
-        x = x0 - eval_polynomial(coeffs, x0)/eval_derivative_polynomial(coeffs, x0); // xk = xk-1 - p(xk-1)/p'(xk-1)
+    int evaluations = 0, remaining = m, k = 0;
+    while(remaining > 0 && k < max_inter){
+        k++;
+        // Todas as correções são calculadas a partir das mesmas aproximações e aplicadas depois (estilo Jacobi)
+        for(int i = 0; i < m; i++){
+            if(!active[i]){
+                continue;
+            }
+            complex pz, dpz;
+            q.eval(z[i], pz, dpz);
+            evaluations += 2;
+            // |p(z)| já está no nível do erro de arredondamento da própria avaliação: a raíz não melhora mais
+            double modulus = std::abs(z[i]), bound = 0;
+            for(int j = 0; j <= m; j++){
+                bound = bound * modulus + std::abs(c[j]);
+            }
+            settled[i] = std::abs(pz) <= DBL_EPSILON * bound;
+            nudged[i] = 0;
+            if(settled[i]){
+                delta[i] = 0;
+                continue;
+            }
+            complex repulsion = 0;
+            for(int j = 0; j < m; j++){
+                if(j != i){
+                    repulsion += 1.0 / (z[i] - z[j]);
+                }
+            }
+            // w/(1 - w*s) com w = p/p', escrito sem dividir por p' (que pode se anular fora das raízes)
+            complex denominator = dpz - pz * repulsion;
+            metrics::check_division(metrics::POLYNOMIAL_ALL_ROOTS, std::abs(denominator));
+            if(denominator == 0.0){
+                // Correção indefinida: z é deslocado um pouco, para fora do ponto crítico, e continua ativo
+                nudged[i] = 1;
+                delta[i] = std::polar(std::max(modulus, 1.0) * std::sqrt(DBL_EPSILON), 2.0 * i + 0.4);
+            }else{
+                delta[i] = pz / denominator;
+            }
+        }
+        for(int i = 0; i < m; i++){
+            if(!active[i]){
+                continue;
+            }
+            z[i] -= delta[i];
+            step[i] = std::abs(delta[i]);
+            if(settled[i] || (!nudged[i] && step[i] < epsilon)){
+                active[i] = 0;
+                remaining--;
+            }
+        }
         if(verbose){
             std::cout << "========== Iteração " << k << " ==========\n";
-            std::cout << "x = " << x << "\n";
-            std::cout << "p(x) = " << eval_polynomial(coeffs, x) << "\n";
-            std::cout << "p'(x) = " << eval_derivative_polynomial(coeffs, x) << "\n\n";
+            for(int i = 0; i < m; i++){
+                std::cout << "z" << i << " = " << z[i] << (active[i] ? "" : " (convergiu)") << "\n";
+            }
+            std::cout << "\n";
         }
-        // Verificação do critério de parada |xk - xk-1| < epsilon 
-        if(std::abs(x - x0) < epsilon){
-            return {x, k, true, std::abs(eval_polynomial(coeffs, x)), std::abs(x-x0)};
-        }
-        x0 = x;
     }
-    return {x, max_inter, false, std::abs(eval_polynomial(coeffs, x)), std::abs(x-x0)};
-}
 
-double eval_polynomial(const std::vector<double>& coeffs, double x){
-    double y = 0;
-    for(double c: coeffs){
-        y = c + y*x;
+    AllRootsResult result{std::move(z), k, remaining == 0, 0, 0, evaluations};
+    result.roots.insert(result.roots.end(), zeros, complex(0));
+    for(const complex& root: result.roots){
+        complex pz, dpz;
+        p.eval(root, pz, dpz);
+        result.residual = std::max(result.residual, std::abs(pz));
     }
-    return y;
-}
-
-double eval_derivative_polynomial(const std::vector<double>& coeffs, double x){
-    std::vector<double> dif_coeffs;
-    for(int n = coeffs.size()-1, i = 0; i < coeffs.size()-1; n--, i++){
-        dif_coeffs.push_back(coeffs[i]*n);
+    result.function_evaluations += 2 * n;
+    for(double s: step){
+        result.error = std::max(result.error, s);
     }
-    return eval_polynomial(dif_coeffs, x);
-} 
\ No newline at end of file
+    return scope.done(std::move(result));
+}
@@ -1,9 +1,13 @@
 #ifndef ROOT_FINDERS_HPP
 #define ROOT_FINDERS_HPP
 
+#include <complex>
 #include <functional>
 #include <vector>
 #include <string>
+#include "trace.hpp"
+#include "polynomial.hpp"
+#include "dual.hpp"
 
 // TAD que representa o retorno dos métodos implementados
 struct Result {
@@ -12,12 +16,35 @@ struct Result {
     bool converged; // Se o método atingiu a precisão requirida no número de interações especificado
     double residual; // |f(root)|
     double error; 
+    int function_evaluations; // Número de avaliações de f (somadas às de f' nos métodos que a utilizam)
 };
 
+// Intervalo [a, b] com troca de sinal de f (ou a = b, se f(a) = 0 exatamente), com os valores de f nos extremos
+struct Bracket {
+    double a, b;
+    double fa, fb;
+};
+
+// TAD que representa o retorno de polynomial_all_roots
+struct AllRootsResult {
+    std::vector<std::complex<double>> roots; // Todas as raízes (complexas) do polinômio, com multiplicidade
+    int interations; // Número de interações realizadas
+    bool converged; // Se todas as raízes atingiram a precisão requirida no número de interações especificado
+    double residual; // Maior |p(z)| entre as raízes
+    double error; // Maior passo |zk - zk-1| da última interação de cada raíz
+    int function_evaluations; // Número de avaliações de p (somadas às de p')
+};
+
+/*
+Os métodos abaixo recebem std::function e são wrappers finos para as versões templatizadas de generic_solvers.hpp
+(namespace generic), que aceitam qualquer tipo chamável e permitem o inline de f(x) nos laços. Prefira as versões
+de generic_solvers.hpp nos trechos críticos de desempenho.
+*/
+
 // ==================== Métodos robustos ====================
 
 // Método da bissecção
-Result bisection(const std::function<double(double)>& f, double a, double b, double epsilon=1e-5, int max_inter=100, bool verbose=false);
+Result bisection(const std::function<double(double)>& f, double a, double b, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
 /*
 Método numérico baseado na ideia de realizar divisões sucessivas do intervalo [a, b] fornecido pela metade até satisfazer
 o critério de convergência (b - a) < epsilon. OBS: Apenas o critério c1 foi considerado, o critério c2 (f(x) < epsilon) não.
@@ -27,6 +54,7 @@ o critério de convergência (b - a) < epsilon. OBS: Apenas o critério c1 foi c
         (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
         (int) max_inter: Quantidade máxima de interações
         (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
 
     Returns: 
         (Result): Um struct contendo informações relevantes do cálculo da raíz
@@ -34,7 +62,7 @@ o critério de convergência (b - a) < epsilon. OBS: Apenas o critério c1 foi c
 
 
 // Método da posição falsa                 
-Result false_position(const std::function<double(double)>& f, double a, double b, double epsilon=1e-5, int max_inter=100, bool verbose=false);
+Result false_position(const std::function<double(double)>& f, double a, double b, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
 /*
 Método numérico baseado no da bissecção, mas considerando os próprios valores do intervalo na função, fazendo assim uma ponderação da raiz com base
 nos extremos dos intervalos mais próximo de zero.
@@ -44,6 +72,65 @@ nos extremos dos intervalos mais próximo de zero.
         (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
         (int) max_inter: Quantidade máxima de interações
         (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
+
+    Returns: 
+        (Result): Um struct contendo informações relevantes do cálculo da raíz
+*/
+
+// Método de Brent
+Result brent(const std::function<double(double)>& f, double a, double b, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
+/*
+Método numérico que mantém sempre um intervalo com troca de sinal, como a bissecção, mas tenta a cada interação um
+passo de interpolação (secante ou quadrática inversa) a partir das três últimas aproximações. O passo interpolado só é
+aceito se cair dentro do intervalo e reduzi-lo o suficiente; caso contrário é feito um passo de bissecção. Assim a
+convergência é superlinear em funções suaves e nunca pior que a da bissecção. Critério de parada: largura do intervalo
+menor que epsilon (mais o arredondamento relativo de x) ou f(x) = 0.
+    Args:
+        (function) f: Função f(x) a qual desejamos computar a raíz
+        (double) a, b: Extremos do intervalo I = [a, b]
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
+
+    Returns: 
+        (Result): Um struct contendo informações relevantes do cálculo da raíz
+*/
+
+// Método de Illinois (posição falsa modificada)
+Result illinois(const std::function<double(double)>& f, double a, double b, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
+/*
+Variação do método da posição falsa que evita que um dos extremos fique parado (o que acontece em funções convexas e
+torna a posição falsa linear e lenta). Quando o mesmo extremo seria mantido, o valor de f nele é reduzido pelo fator de
+Anderson-Björck (ou pela metade, como no método de Illinois, se esse fator não for positivo), puxando a próxima
+aproximação para o outro lado da raíz. Critério de parada: largura do intervalo menor que epsilon ou f(x) = 0.
+    Args:
+        (function) f: Função f(x) a qual desejamos computar a raíz
+        (double) a, b: Extremos do intervalo I = [a, b]
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
+
+    Returns: 
+        (Result): Um struct contendo informações relevantes do cálculo da raíz
+*/
+
+// Método ITP (Interpolate, Truncate and Project)
+Result itp(const std::function<double(double)>& f, double a, double b, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
+/*
+Método numérico que combina a posição falsa com a bissecção: o ponto interpolado é afastado do ponto médio (truncamento)
+e depois projetado em uma vizinhança do ponto médio cujo raio diminui a cada interação. Com isso o método nunca usa mais
+que uma interação a mais que a bissecção, e em funções suaves converge de forma superlinear. Critério de parada:
+largura do intervalo menor que epsilon ou f(x) = 0.
+    Args:
+        (function) f: Função f(x) a qual desejamos computar a raíz
+        (double) a, b: Extremos do intervalo I = [a, b]
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
 
     Returns: 
         (Result): Um struct contendo informações relevantes do cálculo da raíz
@@ -52,7 +139,7 @@ nos extremos dos intervalos mais próximo de zero.
 // ==================== Métodos rápidos ====================
 
 // Método do ponto fixo
-Result fixed_point(const std::function<double(double)>& phi, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false);
+Result fixed_point(const std::function<double(double)>& phi, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
 /*
 Método numérico (de convergência linear) onde dado uma função de interação phi que gere uma série convergente, temos a aproximação da raíz através da aproximação de um ponto fixo.
 O método implementado considera que a função phi(x) satisfaz os critérios de convergência. 
@@ -62,13 +149,75 @@ O método implementado considera que a função phi(x) satisfaz os critérios de
         (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
         (int) max_inter: Quantidade máxima de interações
         (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
 
     Returns: 
-        (Result): Um struct contendo informações relevantes do cálculo da raíz
+        (Result): Um struct contendo informações relevantes do cálculo da raíz. Como phi não é f, residual e error
+        são ambos |phi(x) - x| no último x a partir do qual phi foi avaliada
+*/
+
+// Método do ponto fixo com extrapolação de Aitken
+Result fixed_point_aitken(const std::function<double(double)>& phi, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
+/*
+Ponto fixo em que a sequência xk+1 = phi(xk) é acompanhada da extrapolação de Aitken (delta²) dos três últimos
+termos, que converge para o ponto fixo mais rápido que a própria sequência (ainda linearmente, mas em cerca de
+metade das interações). Uma avaliação de phi por interação; quando a segunda diferença se anula, a estimativa é o
+próprio termo da sequência.
+    Args:
+        (function) phi: Função de interação phi(x) a qual aproximos o ponto fixo.
+        (double) x0: Aproximação inicial
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada (x é a estimativa de Aitken)
+
+    Returns:
+        (Result): Um struct contendo informações relevantes do cálculo da raíz. root é a última estimativa, error é
+        a diferença entre as duas últimas estimativas e residual é |phi(x) - x| no último termo da sequência
+*/
+
+// Método de Steffensen
+Result steffensen(const std::function<double(double)>& phi, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
+/*
+Ponto fixo de convergência quadrática sem derivadas: cada interação calcula phi(x) e phi(phi(x)) e recomeça da
+extrapolação de Aitken desses três pontos. Converge mesmo quando phi contrai devagar (|phi'| perto de 1) ou não
+contrai. Se o ponto extrapolado não reduz |phi(x) - x| (ou phi não é finita nele), ele é descartado e o método segue
+com os dois passos simples já calculados.
+    Args:
+        (function) phi: Função de interação phi(x) a qual aproximos o ponto fixo.
+        (double) x0: Aproximação inicial
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
+
+    Returns:
+        (Result): Um struct contendo informações relevantes do cálculo da raíz, com residual e error como em fixed_point
+*/
+
+// Método do ponto fixo com mistura de Anderson
+Result anderson(const std::function<double(double)>& phi, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr, int window=2);
+/*
+Ponto fixo com mistura de Anderson: o próximo ponto combina os últimos window + 1 valores de phi de modo a anular
+(por mínimos quadrados) o resíduo phi(x) - x. Em uma dimensão equivale à secante em phi(x) - x com a inclinação
+média da janela (window = 1 é a própria secante), com uma avaliação de phi por interação e convergência
+superlinear. Se o ponto acelerado não reduz |phi(x) - x| (ou phi não é finita nele), o histórico é descartado e o
+método segue com o passo simples.
+    Args:
+        (function) phi: Função de interação phi(x) a qual aproximos o ponto fixo.
+        (double) x0: Aproximação inicial
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
+        (int) window: Número de diferenças guardadas no histórico, entre 1 e 8
+
+    Returns:
+        (Result): Um struct contendo informações relevantes do cálculo da raíz, com residual e error como em fixed_point
 */
 
 // Método de Newton-Raphson                 
-Result newton_raphson(const std::function<double(double)>& f, const std::function<double(double)>& df, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false);
+Result newton_raphson(const std::function<double(double)>& f, const std::function<double(double)>& df, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
 /*
 Método numérico (de convergência quadrática) baseado no ponto fixo, onde obtemos uma função de interação a partir de f'(x). O método implementado supõem que f(x), f'(x) e f''(x) são contínuas
 no intervalo em que se deseja obter a raiz, e que f'(x) é diferente de zero nas iterações.
@@ -79,13 +228,52 @@ no intervalo em que se deseja obter a raiz, e que f'(x) é diferente de zero nas
         (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
         (int) max_inter: Quantidade máxima de interações
         (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
 
     Returns: 
-        (Result): Um struct contendo informações relevantes do cálculo da raíz
+        (Result): Um struct contendo informações relevantes do cálculo da raíz. Se f'(x) se anula (passo não finito) ou
+        x sai do domínio de f (f(x) não finita), o método para com converged = false na última aproximação finita e
+        error = infinito
+*/
+
+// Método de Newton-Raphson com diferenciação automática
+Result newton_raphson_ad(const std::function<ad::Dual(ad::Dual)>& f, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
+/*
+Mesmo método de Newton-Raphson, mas f'(x) é obtida por diferenciação automática (dual.hpp): f é escrita uma única vez,
+de forma genérica (por exemplo [a](auto d){ return a*d - d*log(d); }), e cada avaliação em um número dual dá f(x) e
+f'(x) juntas, compartilhando as subexpressões. Cada avaliação dual é contada como uma avaliação em function_evaluations.
+    Args:
+        (function) f: Função f(x) a qual desejamos computar a raíz, avaliada em ad::Dual
+        (double) x0: Aproximação inicial
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
+
+    Returns: 
+        (Result): Um struct contendo informações relevantes do cálculo da raíz, com a mesma salvaguarda de newton_raphson
+*/
+
+// Método de Halley
+Result halley(const std::function<ad::Dual2(ad::Dual2)>& f, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
+/*
+Método numérico (de convergência cúbica) que usa também f''(x): xk = xk-1 - 2f f'/(2f'^2 - f f''), com f, f' e f''
+obtidas numa única avaliação de f em ad::Dual2. Supõe f, f', f'' e f''' contínuas perto da raíz e f'(x) diferente de
+zero nas iterações. Critério de parada: |xk - xk-1| < epsilon. Cada avaliação dual conta como uma avaliação.
+    Args:
+        (function) f: Função f(x) a qual desejamos computar a raíz, avaliada em ad::Dual2
+        (double) x0: Aproximação inicial
+        (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
+
+    Returns: 
+        (Result): Um struct contendo informações relevantes do cálculo da raíz, com a mesma salvaguarda de newton_raphson
 */
 
 // Método da Secante
-Result secant(const std::function<double(double)>& f, double x0, double x1, double epsilon=1e-5, int max_inter=100, bool verbose=false);
+Result secant(const std::function<double(double)>& f, double x0, double x1, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
 /*
 Método numérico (de convergência p = 1.618...) baseado no de Newton-Raphson, onde aproximamos o cálculo de f'(x) através de uma secante.
     Args:
@@ -94,13 +282,14 @@ Método numérico (de convergência p = 1.618...) baseado no de Newton-Raphson,
         (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
         (int) max_inter: Quantidade máxima de interações
         (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
 
     Returns: 
         (Result): Um struct contendo informações relevantes do cálculo da raíz
 */
 
 // Método de Newton-Raphson adaptado para polinômios
-Result polynomial_newton_raphson(const std::vector<double>& coeffs, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false);
+Result polynomial_newton_raphson(const std::vector<double>& coeffs, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
 /*
 Método numérico baseado no de Newton-Raphson. A atenção se dá pelo fato da função ser garantidamente um polinômio, onde assim podemos aplicar
 métodos específicos para o cálculo do polinômio avaliado para algum valor bem como para a sua derivada.
@@ -110,8 +299,39 @@ métodos específicos para o cálculo do polinômio avaliado para algum valor be
         (double) epsilon: Valor de tolerância mínimo para a raíz computada (precisão)
         (int) max_inter: Quantidade máxima de interações
         (bool) verbose: Flag indicadora se o usuário deseja imprimir o valor da raíz para cada interação
+        (TraceBuffer*) trace: Buffer opcional onde cada iteração é registrada, sem impressão nem avaliações extras de f
 
     Returns: 
         (Result): Um struct contendo informações relevantes do cálculo da raíz
 */
+
+Result polynomial_newton_raphson(const Polynomial& p, double x0, double epsilon=1e-5, int max_inter=100, bool verbose=false, TraceBuffer* trace=nullptr);
+/*
+Mesmo método, recebendo um Polynomial já construído (com os coeficientes de p' pré-calculados). Prefira esta versão
+quando o mesmo polinômio for resolvido a partir de vários x0. Quando o grau é conhecido em tempo de compilação,
+generic::polynomial_newton_raphson com um FixedPolynomial<N> evita os laços sobre o vetor de coeficientes.
+*/
+
+// Método de Aberth-Ehrlich para todas as raízes de um polinômio
+AllRootsResult polynomial_all_roots(const Polynomial& p, double epsilon=1e-10, int max_inter=500, bool verbose=false);
+/*
+Método numérico que aproxima simultaneamente todas as n raízes (complexas) de um polinômio de grau n. Assim como o
+de Durand-Kerner, cada interação corrige todas as aproximações de uma vez, mas a correção de Newton de cada raíz é
+combinada com uma repulsão das demais, zk = zk - w/(1 - w*sum_{j!=k} 1/(zk - zj)) com w = p(zk)/p'(zk), o que dá
+convergência cúbica e evita que duas aproximações caiam na mesma raíz. As aproximações iniciais são distribuídas
+em um círculo cujo raio limita o módulo das raízes, sem precisar de chutes do usuário.
+
+As raízes nulas (coeficientes de menor grau iguais a zero) são retiradas do polinômio antes do método, e cada raíz
+que satisfaz |zk - zk-1| < epsilon, ou cujo |p(zk)| já está no nível do erro de arredondamento, deixa de ser
+atualizada (deflação implícita), continuando apenas na repulsão das demais. Se o denominador da correção se anula, a
+aproximação é deslocada um pouco e continua ativa (esse passo não conta para o critério de parada).
+    Args:
+        (Polynomial) p: Polinômio do qual desejamos computar as raízes
+        (double) epsilon: Valor de tolerância mínimo para as raízes computadas (precisão)
+        (int) max_inter: Quantidade máxima de interações
+        (bool) verbose: Flag indicadora se o usuário deseja imprimir as raízes para cada interação
+
+    Returns: 
+        (AllRootsResult): Um struct contendo as raízes e informações relevantes do cálculo
+*/
 #endif
\ No newline at end of file
@@ -0,0 +1,191 @@
+#ifndef ROOT_ISOLATION_HPP
+#define ROOT_ISOLATION_HPP
+
+#include "root_finders.hpp"
+#include "generic_solvers.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+/*
+Isolamento de raízes: varre um domínio [lo, hi] e encontra os intervalos com troca de sinal de f, que podem ser
+passados diretamente aos métodos de barramento (bissecção, posição falsa, Brent, ...) sem que o usuário precise
+escolher [a, b] à mão.
+
+O domínio é dividido em 'cells' células iguais, cada uma uma tarefa de um WorkStealingPool. Uma célula com troca de
+sinal vira um barramento. Uma célula sem troca de sinal é dividida ao meio quando o ponto médio indica que pode haver
+raízes escondidas nela: se f(meio) tem sinal diferente dos extremos (duas raízes), se |f(meio)| é menor que |f| nos
+dois extremos, ou se a parábola pelos três pontos tem o vértice dentro da célula e próximo de zero (|f| se aproxima de
+zero dentro da célula, como acontece perto de um par de raízes próximas). As
+metades viram novas tarefas, de modo que o trabalho extra se concentra nas regiões suspeitas e é roubado pelas
+threads ociosas. A subdivisão para após max_depth níveis, então pares de raízes mais próximos que
+(hi - lo)/(cells * 2^max_depth) podem passar despercebidos, assim como raízes de multiplicidade par sem mergulho de |f|.
+
+Pontos onde f não é finita são tratados como sem informação (a célula é subdividida, desde que f seja finita em algum
+dos pontos avaliados), o que permite varrer domínios que incluem pontos fora do domínio de f, como d <= 0 em d*ln(d).
+*/
+
+namespace isolation_detail {
+
+inline bool sign_change(double fa, double fb){
+    return std::isfinite(fa) && std::isfinite(fb) && ((fa < 0 && fb > 0) || (fa > 0 && fb < 0));
+}
+
+// Indica se uma célula sem troca de sinal, com f(meio) = fm, pode esconder raízes. Com f(a) = 0 (uma raíz exata no
+// extremo, que não conta como troca de sinal), a troca entre o meio e b também torna a célula suspeita
+inline bool suspicious(double fa, double fm, double fb){
+    int finite = std::isfinite(fa) + std::isfinite(fb) + std::isfinite(fm);
+    if(finite == 0){
+        // f não é finita em nenhum dos três pontos: a célula provavelmente está fora do domínio de f
+        return false;
+    }
+    if(finite < 3 || fm == 0 || sign_change(fa, fm) || sign_change(fm, fb) || (std::abs(fm) < std::abs(fa) && std::abs(fm) < std::abs(fb))){
+        return true;
+    }
+    // Parábola pelos três pontos, p(s) = fm + s*(fb - fa)/2 + s^2*(fa - 2fm + fb)/2 com s em [-1, 1]: se o vértice
+    // cai dentro da célula e fica perto de zero (ou do outro lado dele), pode haver um par de raízes ali
+    double curvature = fa - 2*fm + fb;
+    double s = curvature != 0 ? (fa - fb) / (2*curvature) : 2;
+    if(std::abs(s) > 1){
+        return false;
+    }
+    double fv = fm - (fb - fa)*(fb - fa) / (8*curvature);
+    return sign_change(fm, fv) || std::abs(fv) < 0.5 * std::min({std::abs(fa), std::abs(fm), std::abs(fb)});
+}
+
+// Processa a célula [a, b] (f(a) e f(b) já conhecidos). Raízes exatas nos extremos são entregues por quem calculou
+// f neles (isolate_roots para a grade inicial, a célula mãe para os pontos de subdivisão), uma única vez
+template <class F, class OnBracket>
+void scan_cell(const F& f, double a, double b, double fa, double fb, int depth, WorkStealingPool& pool, const OnBracket& on_bracket){
+    bool change = sign_change(fa, fb);
+    if(depth <= 0){
+        if(change){
+            on_bracket(Bracket{a, b, fa, fb});
+        }
+        return;
+    }
+    double m = 0.5 * (a + b);
+    double fm = f(m);
+    if(!change && !suspicious(fa, fm, fb)){
+        return;
+    }
+    if(fm == 0){
+        on_bracket(Bracket{m, m, fm, fm});
+    }
+    // A metade com troca de sinal vira um barramento (com metade da largura); a outra ainda pode esconder um par de
+    // raízes (se a célula tinha três, por exemplo) e é examinada de novo
+    auto half = [&f, depth, &pool, &on_bracket](double a, double b, double fa, double fb){
+        if(sign_change(fa, fb)){
+            on_bracket(Bracket{a, b, fa, fb});
+        }else{
+            scan_cell(f, a, b, fa, fb, depth - 1, pool, on_bracket);
+        }
+    };
+    pool.submit([half, a, m, fa, fm]{ half(a, m, fa, fm); });
+    half(m, b, fm, fb);
+}
+
+} // namespace isolation_detail
+
+// Varredura de [lo, hi] em busca de barramentos
+template <class F, class OnBracket>
+void isolate_roots(const F& f, double lo, double hi, WorkStealingPool& pool, const OnBracket& on_bracket, int cells=0, int max_depth=12);
+/*
+Encontra os intervalos com troca de sinal de f em [lo, hi] e os entrega, assim que são encontrados, para on_bracket.
+Raízes exatas sobre os pontos avaliados (f(x) == 0) são entregues uma única vez, como barramentos degenerados (a == b).
+    Args:
+        (F) f: Função f(x), chamada concorrentemente pelas threads do pool
+        (double) lo, hi: Extremos do domínio varrido
+        (WorkStealingPool) pool: Pool de threads usado na varredura
+        (OnBracket) on_bracket: Chamado com cada Bracket encontrado, de qualquer thread do pool e em qualquer ordem
+                                (deve ser thread-safe)
+        (int) cells: Número de células iniciais (0 = 64 por thread do pool)
+        (int) max_depth: Quantidade máxima de subdivisões de uma célula sem troca de sinal
+*/
+
+// Varredura de [lo, hi], com os barramentos devolvidos em ordem crescente
+template <class F>
+std::vector<Bracket> find_brackets(const F& f, double lo, double hi, WorkStealingPool& pool, int cells=0, int max_depth=12);
+
+// Todas as raízes de f em [lo, hi]
+template <class F>
+std::vector<Result> find_all_roots(const F& f, double lo, double hi, WorkStealingPool& pool, double epsilon=1e-5, int max_inter=100, int cells=0, int max_depth=12);
+/*
+Isola as raízes de f em [lo, hi] e refina cada barramento com o método de Brent na mesma tarefa em que ele foi
+encontrado, sem esperar o fim da varredura.
+    Args:
+        (F) f: Função f(x), chamada concorrentemente pelas threads do pool
+        (double) lo, hi: Extremos do domínio varrido
+        (WorkStealingPool) pool: Pool de threads usado na varredura e no refinamento
+        (double) epsilon: Valor de tolerância mínimo para as raízes computadas (precisão)
+        (int) max_inter: Quantidade máxima de interações do método de Brent em cada barramento
+        (int) cells, max_depth: Parâmetros da varredura (ver isolate_roots)
+
+    Returns:
+        (vector<Result>): Um Result por raíz encontrada, em ordem crescente de raíz. As avaliações de f da varredura
+                          não são contadas em function_evaluations, exceto as dos extremos de cada barramento
+*/
+
+// ==================== Implementação ====================
+
+template <class F, class OnBracket>
+void isolate_roots(const F& f, double lo, double hi, WorkStealingPool& pool, const OnBracket& on_bracket, int cells, int max_depth){
+    if(cells <= 0){
+        cells = 64 * pool.size();
+    }
+    if(!(hi > lo)){
+        return;
+    }
+    // Valores de f na grade inicial, calculados uma única vez (cada ponto interno é extremo de duas células)
+    double h = (hi - lo) / cells;
+    std::vector<double> grid(cells + 1);
+    pool.parallel_for(cells + 1, 64, [&](std::size_t i){
+        grid[i] = f(i == (std::size_t)cells ? hi : lo + i * h);
+    });
+    for(int i = 0; i < cells; i++){
+        double a = lo + i * h, b = i + 1 == cells ? hi : lo + (i + 1) * h;
+        double fa = grid[i], fb = grid[i + 1];
+        pool.submit([&f, a, b, fa, fb, max_depth, &pool, &on_bracket]{
+            isolation_detail::scan_cell(f, a, b, fa, fb, max_depth, pool, on_bracket);
+        });
+    }
+    pool.wait();
+    // Raízes exatas sobre a grade, como barramentos degenerados (a = b)
+    for(int i = 0; i <= cells; i++){
+        if(grid[i] == 0){
+            double x = i == cells ? hi : lo + i * h;
+            on_bracket(Bracket{x, x, 0.0, 0.0});
+        }
+    }
+}
+
+template <class F>
+std::vector<Bracket> find_brackets(const F& f, double lo, double hi, WorkStealingPool& pool, int cells, int max_depth){
+    std::vector<Bracket> brackets;
+    std::mutex mutex;
+    isolate_roots(f, lo, hi, pool, [&](const Bracket& bracket){
+        std::lock_guard<std::mutex> lock(mutex);
+        brackets.push_back(bracket);
+    }, cells, max_depth);
+    std::sort(brackets.begin(), brackets.end(), [](const Bracket& p, const Bracket& q){ return p.a < q.a; });
+    return brackets;
+}
+
+template <class F>
+std::vector<Result> find_all_roots(const F& f, double lo, double hi, WorkStealingPool& pool, double epsilon, int max_inter, int cells, int max_depth){
+    std::vector<Result> roots;
+    std::mutex mutex;
+    isolate_roots(f, lo, hi, pool, [&](const Bracket& bracket){
+        Result r = bracket.a == bracket.b
+            ? Result{bracket.a, 0, true, 0.0, 0.0, 0}
+            : generic::brent(f, bracket, epsilon, max_inter);
+        std::lock_guard<std::mutex> lock(mutex);
+        roots.push_back(r);
+    }, cells, max_depth);
+    std::sort(roots.begin(), roots.end(), [](const Result& p, const Result& q){ return p.root < q.root; });
+    return roots;
+}
+
+#endif
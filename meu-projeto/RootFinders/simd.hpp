@@ -0,0 +1,182 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+#include <cstring>
+#include <cstdint>
+#include <limits>
+#include <cmath>
+
+/*
+Abstração mínima de vetores SIMD baseada nas extensões de vetor do GCC/Clang (__attribute__((vector_size))).
+O mesmo código gera AVX2 (4 doubles por vetor) ou SSE2 (2 doubles) no build nativo e SIMD128 (2 doubles) no build
+do Emscripten, de acordo com as flags de compilação:
+    nativo:      g++ -O2 -mavx2 ...   (ou -march=native)
+    emscripten:  em++ -O2 -msimd128 ...
+Sem nenhuma dessas flags o vetor possui uma única lane e o código continua correto (apenas escalar).
+*/
+
+#ifndef RF_SIMD_BYTES
+#if defined(__AVX__)
+#define RF_SIMD_BYTES 32
+#elif defined(__SSE2__) || defined(__wasm_simd128__) || defined(__ARM_NEON)
+#define RF_SIMD_BYTES 16
+#else
+#define RF_SIMD_BYTES 8
+#endif
+#endif
+
+namespace simd {
+
+typedef double vdouble __attribute__((vector_size(RF_SIMD_BYTES)));
+// Resultado das comparações entre vdouble: cada lane vale -1 (verdadeiro) ou 0 (falso)
+typedef decltype(vdouble{} < vdouble{}) vmask;
+// Bits de um vdouble interpretados como inteiros sem sinal
+typedef std::uint64_t vbits __attribute__((vector_size(RF_SIMD_BYTES)));
+
+constexpr int width = RF_SIMD_BYTES / sizeof(double);
+
+inline vdouble splat(double x){
+    return vdouble{} + x;
+}
+
+inline vdouble load(const double* p){
+    vdouble v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline void store(double* p, vdouble v){
+    std::memcpy(p, &v, sizeof(v));
+}
+
+// Seleciona a lane de 'a' onde a máscara é verdadeira e a de 'b' caso contrário
+inline vdouble select(vmask m, vdouble a, vdouble b){
+    return m ? a : b;
+}
+
+inline bool any(vmask m){
+    for(int i = 0; i < width; i++){
+        if(m[i]) return true;
+    }
+    return false;
+}
+
+inline vdouble abs(vdouble x){
+    return (vdouble)((vmask)x & (vmask{} + 0x7FFFFFFFFFFFFFFFLL));
+}
+
+// Logaritmo natural por lane. Decompõe x = m * 2^e com m em [sqrt(2)/2, sqrt(2)) e usa
+// log(m) = 2*atanh(s), s = (m-1)/(m+1), cuja série converge rápido (|s| < 0.172). Erro de no máximo 2 ulp.
+// Lanes fora dos normais positivos finitos (0, negativos, subnormais, inf, NaN) caem em std::log.
+inline vdouble log(vdouble x){
+    const double ln2_hi = 6.93147180369123816490e-01;
+    const double ln2_lo = 1.90821492927058770002e-10;
+
+    // Deslocamento lógico (sem sinal) e conversão do expoente para double pelo truque do número mágico 2^52,
+    // ambos disponíveis em SSE2/SIMD128 (ao contrário do deslocamento aritmético e da conversão int64 -> double)
+    vbits bits = (vbits)x;
+    vbits biased = (bits >> 52) & 0x7FF;
+    vdouble e = (vdouble)(biased | 0x4330000000000000ULL) - (4503599627370496.0 + 1023.0);
+    vdouble m = (vdouble)((bits & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL);
+
+    vmask big = m > 1.41421356237309504880;
+    m = select(big, m * 0.5, m);
+    e = select(big, e + 1.0, e);
+
+    // Série em z = s^2 avaliada pelo esquema de Estrin, que encurta a cadeia de dependências
+    vdouble s = (m - 1.0) / (m + 1.0);
+    vdouble z = s * s;
+    vdouble z2 = z * z;
+    vdouble z4 = z2 * z2;
+    vdouble p01 = 1.0/3 + z * (1.0/5);
+    vdouble p23 = 1.0/7 + z * (1.0/9);
+    vdouble p45 = 1.0/11 + z * (1.0/13);
+    vdouble p67 = 1.0/15 + z * (1.0/17);
+    vdouble p89 = 1.0/19 + z * (1.0/21);
+    vdouble p = (p01 + z2 * p23) + z4 * ((p45 + z2 * p67) + z4 * p89);
+    vdouble log_m = 2.0 * s + 2.0 * s * z * p;
+
+    vdouble r = e * ln2_hi + (e * ln2_lo + log_m);
+
+    vmask regular = (x >= std::numeric_limits<double>::min()) & (x <= std::numeric_limits<double>::max());
+    if(any(~regular)){
+        for(int i = 0; i < width; i++){
+            if(!regular[i]) r[i] = std::log(x[i]);
+        }
+    }
+    return r;
+}
+
+/*
+Vetores de float com o mesmo tamanho em bytes de vdouble, logo com o dobro de lanes (8 em AVX2, 4 em SSE2/SIMD128).
+Usados na primeira fase dos métodos de precisão mista de batch_solvers.hpp, que iteram em float até o limite da
+precisão simples e só então refinam em double.
+*/
+typedef float vfloat __attribute__((vector_size(RF_SIMD_BYTES)));
+typedef decltype(vfloat{} < vfloat{}) vfmask;
+typedef std::uint32_t vfbits __attribute__((vector_size(RF_SIMD_BYTES)));
+
+constexpr int width_f = RF_SIMD_BYTES / sizeof(float);
+
+inline vfloat splat_f(float x){
+    return vfloat{} + x;
+}
+
+inline vfloat select(vfmask m, vfloat a, vfloat b){
+    return m ? a : b;
+}
+
+inline bool any(vfmask m){
+    for(int i = 0; i < width_f; i++){
+        if(m[i]) return true;
+    }
+    return false;
+}
+
+inline vfloat abs(vfloat x){
+    return (vfloat)((vfmask)x & (vfmask{} + 0x7FFFFFFF));
+}
+
+// Metade h (0 ou 1) das lanes de um vfloat convertida para double
+inline vdouble to_double(vfloat x, int h){
+    vdouble r;
+    for(int l = 0; l < width; l++){
+        r[l] = x[h * width + l];
+    }
+    return r;
+}
+
+// Logaritmo natural por lane em float, pela mesma decomposição de log(vdouble) com a série truncada em s^9
+// (|s| < 0.172, erro de truncamento abaixo de 1 ulp de float)
+inline vfloat log(vfloat x){
+    const float ln2_hi = 6.9313812256e-01f;
+    const float ln2_lo = 9.0580006145e-06f;
+
+    vfbits bits = (vfbits)x;
+    vfbits biased = (bits >> 23) & 0xFF;
+    vfloat e = (vfloat)(biased | 0x4B000000u) - (8388608.0f + 127.0f);
+    vfloat m = (vfloat)((bits & 0x007FFFFFu) | 0x3F800000u);
+
+    vfmask big = m > 1.41421356f;
+    m = select(big, m * 0.5f, m);
+    e = select(big, e + 1.0f, e);
+
+    vfloat s = (m - 1.0f) / (m + 1.0f);
+    vfloat z = s * s;
+    vfloat p = 1.0f/3 + z * (1.0f/5 + z * (1.0f/7 + z * (1.0f/9)));
+    vfloat log_m = 2.0f * s + 2.0f * s * z * p;
+
+    vfloat r = e * ln2_hi + (e * ln2_lo + log_m);
+
+    vfmask regular = (x >= std::numeric_limits<float>::min()) & (x <= std::numeric_limits<float>::max());
+    if(any(~regular)){
+        for(int i = 0; i < width_f; i++){
+            if(!regular[i]) r[i] = std::log(x[i]);
+        }
+    }
+    return r;
+}
+
+} // namespace simd
+
+#endif
@@ -0,0 +1,319 @@
+#ifndef SWEEP_HPP
+#define SWEEP_HPP
+
+#ifndef _WIN32
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "result_file.hpp"
+#include "root_finders.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*
+Varreduras grandes de a em vários processos (só Linux/Unix: usa fork e mmap compartilhado), com retomada após uma
+interrupção.
+
+Os n valores a_i = a0 + (a1 - a0) i / (n - 1) são divididos em blocos (shards) de shard_size valores. O arquivo de
+saída é o arquivo colunar de result_file.hpp, criado já no tamanho final e mapeado com MAP_SHARED em todos os
+processos: a linha do valor i e do método m fica sempre na posição i*M + m, então cada processo escreve os seus
+resultados direto no arquivo, sem cópias entre processos, e o arquivo final é idêntico byte a byte qualquer que seja o
+número de processos ou a ordem em que os blocos terminaram.
+
+Ao lado fica o checkpoint (arquivo de saída + ".ckpt"), também mapeado por todos: os parâmetros da varredura, um
+contador atômico de onde os processos reservam o próximo bloco pendente e um byte por bloco, marcado depois que as
+linhas do bloco foram gravadas em disco (msync). Se a varredura é interrompida (processo morto, máquina desligada), a
+próxima execução com os mesmos parâmetros só resolve os blocos não marcados.
+
+No fim, com todos os blocos marcados, o número de linhas é escrito no cabeçalho do arquivo de resultados (até lá ele
+é 0, então um arquivo incompleto é lido por ResultFile como vazio) e o checkpoint é removido.
+*/
+
+const char SWEEP_CHECKPOINT_MAGIC[8] = {'R', 'F', 'S', 'W', 'E', 'E', 'P', 0};
+const uint32_t SWEEP_CHECKPOINT_VERSION = 1;
+const size_t SWEEP_CHECKPOINT_HEADER_SIZE = 128;
+
+struct SweepConfig {
+    double a0 = 0, a1 = 1;
+    uint64_t n = 0;
+    double epsilon = 1e-5;
+    int max_iter = 100;
+    std::string function;      // Expressão de --funcao (vazia para fa(a)); entra na validação do checkpoint
+    uint32_t shard_size = 4096;
+    int processes = 1;
+};
+
+inline double sweep_a(const SweepConfig& c, uint64_t i){
+    if(c.n == 1 || i == 0){
+        return c.a0;
+    }
+    return i == c.n - 1 ? c.a1 : c.a0 + (c.a1 - c.a0) * (double)i / (double)(c.n - 1);
+}
+
+// Cabeçalho do checkpoint, seguido de um byte por bloco (1 = concluído)
+struct SweepCheckpointHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t n_methods;
+    double a0, a1, epsilon;
+    uint64_t n;
+    int32_t max_iter;
+    uint32_t shard_size;
+    uint64_t function_hash;
+    std::atomic<uint64_t> next;  // Próximo índice da lista de blocos pendentes (zerado a cada execução)
+};
+static_assert(sizeof(SweepCheckpointHeader) <= SWEEP_CHECKPOINT_HEADER_SIZE, "cabeçalho maior que o espaço reservado");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "o contador compartilhado entre processos precisa ser lock-free");
+
+namespace sweep_detail {
+
+inline uint64_t fnv1a(const std::string& s){
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for(unsigned char c: s){
+        h = (h ^ c) * 0x100000001b3ULL;
+    }
+    return h;
+}
+
+// Arquivo mapeado para leitura e escrita, compartilhado com os processos filhos. Com create, o arquivo é recriado
+// com size bytes; sem, o arquivo existente é mapeado inteiro e size() é o seu tamanho
+class SharedMapping {
+public:
+    SharedMapping(const std::string& path, uint64_t size, bool create) : size_(size) {
+        int fd = ::open(path.c_str(), create ? O_RDWR | O_CREAT | O_TRUNC : O_RDWR, 0644);
+        if(fd < 0){
+            throw std::runtime_error("Não foi possível abrir " + path + ": " + std::strerror(errno));
+        }
+        struct stat st;
+        bool ok = create ? ftruncate(fd, (off_t)size) == 0 : fstat(fd, &st) == 0 && st.st_size > 0;
+        if(ok){
+            size_ = create ? size : (uint64_t)st.st_size;
+            void* p = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            data_ = p == MAP_FAILED ? nullptr : (char*)p;
+        }
+        ::close(fd);
+        if(!data_){
+            throw std::runtime_error((create ? "Não foi possível criar " : "Não foi possível mapear ") + path);
+        }
+    }
+
+    SharedMapping(const SharedMapping&) = delete;
+    SharedMapping& operator=(const SharedMapping&) = delete;
+
+    ~SharedMapping(){
+        munmap(data_, size_);
+    }
+
+    char* data() const { return data_; }
+    uint64_t size() const { return size_; }
+
+    // Grava [offset, offset + bytes) em disco, alinhando às páginas
+    bool sync(uint64_t offset, uint64_t bytes) const {
+        uint64_t page = (uint64_t)sysconf(_SC_PAGESIZE), start = offset / page * page;
+        return bytes == 0 || msync(data_ + start, offset + bytes - start, MS_SYNC) == 0;
+    }
+
+    bool sync() const { return sync(0, size_); }
+
+private:
+    uint64_t size_;
+    char* data_ = nullptr;
+};
+
+inline bool exists(const std::string& path){
+    struct stat st;
+    return stat(path.c_str(), &st) == 0;
+}
+
+} // namespace sweep_detail
+
+template <class Solve>
+int run_sweep(const std::string& path, const SweepConfig& config, const std::vector<std::string>& methods, Solve&& solve){
+    /*
+    Resolve a varredura em config.processes processos, retomando do checkpoint se ele existir.
+
+    Args:
+        (const std::string&) path: Arquivo de resultados (result_file.hpp); o checkpoint fica em path + ".ckpt"
+        (const SweepConfig&) config: Valores de a, tolerâncias, tamanho dos blocos e número de processos
+        (const std::vector<std::string>&) methods: Nomes dos M métodos resolvidos para cada valor de a
+        (Solve&&) solve: void solve(double a, Result* r), que escreve os M resultados de a em r. Roda nos processos
+            filhos (criados por fork), então pode usar qualquer estado preparado antes da chamada
+
+    Returns:
+        (int): 0 se a varredura terminou; 1 se algum processo falhou e restam blocos pendentes (o checkpoint fica, e
+        uma nova execução com os mesmos parâmetros retoma de onde parou)
+
+    Lança runtime_error se os parâmetros forem inválidos, se os arquivos não puderem ser criados ou se o checkpoint
+    existente for de outra varredura.
+    */
+    using namespace sweep_detail;
+    const uint64_t M = methods.size();
+    if(config.n == 0 || config.shard_size == 0 || M == 0 || M > RESULT_FILE_MAX_METHODS){
+        throw std::runtime_error("Varredura inválida: é preciso n > 0, blocos não vazios e de 1 a "
+                                 + std::to_string(RESULT_FILE_MAX_METHODS) + " métodos");
+    }
+    const uint64_t rows = config.n * M;
+    const uint64_t n_shards = (config.n + config.shard_size - 1) / config.shard_size;
+    const std::string checkpoint_path = path + ".ckpt";
+
+    uint64_t file_size;
+    ResultFileHeader header = result_file_header(rows, methods, &file_size);
+    header.n_rows = 0;
+
+    // Sem checkpoint, a varredura começa do zero: primeiro o arquivo de resultados, depois o checkpoint (uma
+    // interrupção entre os dois só faz a próxima execução começar do zero de novo)
+    bool resume = exists(checkpoint_path);
+    SharedMapping results(path, file_size, !resume);
+    SharedMapping checkpoint(checkpoint_path, SWEEP_CHECKPOINT_HEADER_SIZE + n_shards, !resume);
+    SweepCheckpointHeader* ckpt = (SweepCheckpointHeader*)checkpoint.data();
+    uint8_t* done = (uint8_t*)checkpoint.data() + SWEEP_CHECKPOINT_HEADER_SIZE;
+    if(resume){
+        if(checkpoint.size() != SWEEP_CHECKPOINT_HEADER_SIZE + n_shards || results.size() != file_size
+            || std::memcmp(ckpt->magic, SWEEP_CHECKPOINT_MAGIC, sizeof ckpt->magic) != 0 || ckpt->version != SWEEP_CHECKPOINT_VERSION
+            || ckpt->n_methods != M || ckpt->a0 != config.a0 || ckpt->a1 != config.a1 || ckpt->epsilon != config.epsilon
+            || ckpt->n != config.n || ckpt->max_iter != config.max_iter || ckpt->shard_size != config.shard_size
+            || ckpt->function_hash != fnv1a(config.function)
+            || std::memcmp(results.data(), &header, sizeof header) != 0){
+            throw std::runtime_error(checkpoint_path + " é de outra varredura (apague-o para começar do zero)");
+        }
+    }else{
+        std::memcpy(results.data(), &header, sizeof header);
+        std::memcpy(ckpt->magic, SWEEP_CHECKPOINT_MAGIC, sizeof ckpt->magic);
+        ckpt->version = SWEEP_CHECKPOINT_VERSION;
+        ckpt->n_methods = (uint32_t)M;
+        ckpt->a0 = config.a0;
+        ckpt->a1 = config.a1;
+        ckpt->epsilon = config.epsilon;
+        ckpt->n = config.n;
+        ckpt->max_iter = config.max_iter;
+        ckpt->shard_size = config.shard_size;
+        ckpt->function_hash = fnv1a(config.function);
+        if(!results.sync(0, sizeof header) || !checkpoint.sync()){
+            throw std::runtime_error("Não foi possível gravar " + checkpoint_path);
+        }
+    }
+    new (&ckpt->next) std::atomic<uint64_t>(0);
+
+    std::vector<uint64_t> pending;
+    for(uint64_t s = 0; s < n_shards; s++){
+        if(!done[s]){
+            pending.push_back(s);
+        }
+    }
+    if(resume){
+        std::fprintf(stderr, "Varredura: retomando, %llu de %llu blocos já concluídos\n",
+                     (unsigned long long)(n_shards - pending.size()), (unsigned long long)n_shards);
+    }
+
+    char* base = results.data();
+    double* col_a = (double*)(base + header.offset[COL_A]);
+    double* col_root = (double*)(base + header.offset[COL_ROOT]);
+    double* col_residual = (double*)(base + header.offset[COL_RESIDUAL]);
+    double* col_error = (double*)(base + header.offset[COL_ERROR]);
+    int32_t* col_interations = (int32_t*)(base + header.offset[COL_INTERATIONS]);
+    int32_t* col_evaluations = (int32_t*)(base + header.offset[COL_FUNCTION_EVALUATIONS]);
+    uint8_t* col_method = (uint8_t*)(base + header.offset[COL_METHOD]);
+    uint8_t* col_converged = (uint8_t*)(base + header.offset[COL_CONVERGED]);
+
+    // Reserva blocos pendentes até acabarem; retorna false se não conseguiu gravar algum em disco
+    auto worker = [&]() -> bool {
+        std::vector<Result> r(M);
+        uint64_t j;
+        while((j = ckpt->next.fetch_add(1)) < pending.size()){
+            uint64_t s = pending[j];
+            uint64_t begin = s * config.shard_size, end = std::min<uint64_t>(config.n, begin + config.shard_size);
+            for(uint64_t i = begin; i < end; i++){
+                double a = sweep_a(config, i);
+                solve(a, r.data());
+                for(uint64_t m = 0; m < M; m++){
+                    uint64_t row = i * M + m;
+                    col_a[row] = a;
+                    col_root[row] = r[m].root;
+                    col_residual[row] = r[m].residual;
+                    col_error[row] = r[m].error;
+                    col_interations[row] = r[m].interations;
+                    col_evaluations[row] = r[m].function_evaluations;
+                    col_method[row] = (uint8_t)m;
+                    col_converged[row] = r[m].converged;
+                }
+            }
+            bool synced = true;
+            for(int c = 0; c < RESULT_FILE_COLUMNS; c++){
+                uint64_t w = RESULT_COLUMN_WIDTH[c];
+                synced = results.sync(header.offset[c] + begin * M * w, (end - begin) * M * w) && synced;
+            }
+            if(!synced){
+                return false;
+            }
+            done[s] = 1;
+            checkpoint.sync(SWEEP_CHECKPOINT_HEADER_SIZE + s, 1);
+        }
+        return true;
+    };
+
+    int processes = (int)std::min<uint64_t>(std::max(1, config.processes), pending.size());
+    std::vector<pid_t> children;
+    for(int p = 0; p < processes; p++){
+        pid_t pid = fork();
+        if(pid == 0){
+            int status = 1;
+            try{
+                status = worker() ? 0 : 1;
+            }catch(const std::exception& e){
+                std::fprintf(stderr, "Varredura: %s\n", e.what());
+            }
+            _exit(status);
+        }
+        if(pid < 0){
+            break;
+        }
+        children.push_back(pid);
+    }
+    bool failed = false;
+    if(children.empty() && !pending.empty()){
+        // Sem fork, a varredura roda no próprio processo
+        failed = !worker();
+    }
+    for(pid_t pid: children){
+        int status;
+        while(waitpid(pid, &status, 0) < 0 && errno == EINTR){}
+        if(!WIFEXITED(status) || WEXITSTATUS(status) != 0){
+            failed = true;
+        }
+    }
+
+    uint64_t remaining = 0;
+    for(uint64_t s = 0; s < n_shards; s++){
+        remaining += !done[s];
+    }
+    if(remaining > 0){
+        std::fprintf(stderr, "Varredura: %llu de %llu blocos pendentes%s; rode de novo para retomar\n",
+                     (unsigned long long)remaining, (unsigned long long)n_shards, failed ? " (algum processo falhou)" : "");
+        return 1;
+    }
+
+    // Todos os blocos estão gravados: publica o número de linhas e descarta o checkpoint
+    ((ResultFileHeader*)base)->n_rows = rows;
+    if(!results.sync(0, sizeof header)){
+        throw std::runtime_error("Não foi possível gravar " + path);
+    }
+    std::remove(checkpoint_path.c_str());
+    return 0;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,394 @@
+#ifndef SYSTEMS_HPP
+#define SYSTEMS_HPP
+
+#include <cfloat>
+#include <cmath>
+#include "dual.hpp"
+#include "metrics.hpp"
+
+/*
+Sistemas não lineares pequenos F(x) = 0, F: R^N -> R^N, com N conhecido em tempo de compilação (até algumas
+dezenas; acima disso as matrizes na pilha ficam grandes demais). Vetores e matrizes têm tamanho fixo e ficam na pilha,
+e os núcleos densos (LU com pivoteamento parcial, produto matriz-vetor) são laços de tamanho N que o compilador
+desenrola, sem nenhuma alocação.
+
+Métodos:
+    - newton: Newton com a jacobiana J(x) fornecida, resolvendo J dx = F(x) por LU a cada interação
+    - newton_ad: o mesmo, com a jacobiana obtida por diferenciação automática (dual.hpp): F é escrita de forma
+      genérica no tipo escalar e avaliada em N passadas com números duais, uma por coluna
+    - broyden: quase-Newton de Broyden ("good Broyden"), que mantém a inversa da jacobiana e a corrige a cada
+      interação com uma atualização de posto 1 (Sherman-Morrison), usando só a avaliação de F que a interação já faz.
+      A jacobiana é calculada só no início (por diferenças finitas, ou fornecida) e de novo apenas se a atualização
+      degenerar
+
+Exemplo, dois parâmetros de foguete acoplados:
+
+    auto F = [](const auto& d){
+        using std::log;
+        return nd::Vector{0.5*d[0] - d[0]*log(d[0]) + 0.1*d[1], -1.0*d[1] - d[1]*log(d[1]) + 0.1*d[0]};
+    };
+    nd::SystemResult<2> r = nd::broyden(F, nd::Vector<2>{1.6, 0.4}, 1e-10);
+
+Critério de parada: ||xk - xk-1||∞ < epsilon, como o |xk - xk-1| < epsilon dos métodos escalares.
+*/
+namespace nd {
+
+template <int N, class T = double>
+struct Vector {
+    static_assert(N >= 1, "Sistema sem incógnitas");
+    T v[N];
+
+    constexpr T& operator[](int i){ return v[i]; }
+    constexpr const T& operator[](int i) const { return v[i]; }
+};
+
+// nd::Vector{a, b, c} deduz N e o tipo dos elementos (double ou ad::Dual) a partir do primeiro
+template <class T, class... U>
+Vector(T, U...) -> Vector<1 + (int)sizeof...(U), T>;
+
+// Matriz N x N, por linhas
+template <int N>
+struct Matrix {
+    double a[N][N];
+
+    constexpr double& operator()(int i, int j){ return a[i][j]; }
+    constexpr const double& operator()(int i, int j) const { return a[i][j]; }
+};
+
+// Retorno dos métodos, no mesmo espírito de Result
+template <int N>
+struct SystemResult {
+    Vector<N> root;            // x onde F(x) é próximo de 0
+    int interations;           // Número de interações realizadas
+    bool converged;            // Se o método atingiu a precisão requirida no número de interações especificado
+    double residual;           // ||F(root)||∞
+    double error;              // ||xk - xk-1||∞ na última interação
+    int function_evaluations;  // Avaliações de F em double (incluindo as das diferenças finitas)
+    int jacobian_evaluations;  // Jacobianas calculadas (fornecidas, por diferenciação automática ou diferenças finitas)
+};
+
+template <int N>
+double norm_inf(const Vector<N>& x){
+    double m = 0;
+    for(int i = 0; i < N; i++){
+        m = std::fmax(m, std::abs(x[i]));
+    }
+    return m;
+}
+
+template <int N>
+bool is_finite(const Vector<N>& x){
+    for(int i = 0; i < N; i++){
+        if(!std::isfinite(x[i])){
+            return false;
+        }
+    }
+    return true;
+}
+
+template <int N>
+Vector<N> multiply(const Matrix<N>& A, const Vector<N>& x){
+    Vector<N> y;
+    for(int i = 0; i < N; i++){
+        double s = 0;
+        for(int j = 0; j < N; j++){
+            s += A(i, j) * x[j];
+        }
+        y[i] = s;
+    }
+    return y;
+}
+
+template <int N>
+bool lu_decompose(Matrix<N>& A, int (&perm)[N]){
+    /*
+    Fatoração PA = LU com pivoteamento parcial, no próprio A: U fica no triângulo superior e L (com diagonal 1,
+    não guardada) abaixo dele. perm[i] é a linha de A original que foi para a posição i.
+
+    Returns:
+        (bool): false se A é singular (algum pivô nulo ou não finito); A fica parcialmente fatorada
+    */
+    for(int i = 0; i < N; i++){
+        perm[i] = i;
+    }
+    for(int k = 0; k < N; k++){
+        int p = k;
+        for(int i = k + 1; i < N; i++){
+            if(std::abs(A(i, k)) > std::abs(A(p, k))){
+                p = i;
+            }
+        }
+        if(!(std::abs(A(p, k)) >= DBL_MIN) || !std::isfinite(A(p, k))){
+            return false;
+        }
+        if(p != k){
+            for(int j = 0; j < N; j++){
+                double t = A(k, j);
+                A(k, j) = A(p, j);
+                A(p, j) = t;
+            }
+            int t = perm[k];
+            perm[k] = perm[p];
+            perm[p] = t;
+        }
+        for(int i = k + 1; i < N; i++){
+            double l = A(i, k) / A(k, k);
+            A(i, k) = l;
+            for(int j = k + 1; j < N; j++){
+                A(i, j) -= l * A(k, j);
+            }
+        }
+    }
+    return true;
+}
+
+// Resolve A x = b com a fatoração de lu_decompose
+template <int N>
+Vector<N> lu_solve(const Matrix<N>& LU, const int (&perm)[N], const Vector<N>& b){
+    Vector<N> x;
+    for(int i = 0; i < N; i++){
+        double s = b[perm[i]];
+        for(int j = 0; j < i; j++){
+            s -= LU(i, j) * x[j];
+        }
+        x[i] = s;
+    }
+    for(int i = N - 1; i >= 0; i--){
+        double s = x[i];
+        for(int j = i + 1; j < N; j++){
+            s -= LU(i, j) * x[j];
+        }
+        x[i] = s / LU(i, i);
+    }
+    return x;
+}
+
+// Jacobiana por diferenciação automática: N avaliações de F com números duais, a coluna j semeada em x[j]
+template <int N, class F>
+Matrix<N> jacobian_ad(F& f, const Vector<N>& x){
+    Matrix<N> J;
+    for(int j = 0; j < N; j++){
+        Vector<N, ad::Dual> xd;
+        for(int i = 0; i < N; i++){
+            xd[i] = ad::Dual(x[i], i == j ? 1 : 0);
+        }
+        auto y = f(xd);
+        for(int i = 0; i < N; i++){
+            J(i, j) = y[i].d;
+        }
+    }
+    return J;
+}
+
+// Jacobiana por diferenças progressivas, reaproveitando fx = F(x): N avaliações de F
+template <int N, class F>
+Matrix<N> jacobian_fd(F& f, const Vector<N>& x, const Vector<N>& fx){
+    Matrix<N> J;
+    for(int j = 0; j < N; j++){
+        Vector<N> xh = x;
+        double h = std::sqrt(DBL_EPSILON) * std::fmax(std::abs(x[j]), 1.0);
+        xh[j] += h;
+        h = xh[j] - x[j];
+        Vector<N> fh = f(xh);
+        for(int i = 0; i < N; i++){
+            J(i, j) = (fh[i] - fx[i]) / h;
+        }
+    }
+    return J;
+}
+
+namespace detail {
+
+// Newton com a jacobiana de jacobian(x), contando em metrics como method
+template <int N, class F, class J>
+SystemResult<N> newton(F& f, J&& jacobian, Vector<N> x, double epsilon, int max_inter, metrics::Method method){
+    metrics::Scope scope(method);
+    Vector<N> fx = f(x);
+    int evaluations = 1, jacobians = 0;
+    double step = INFINITY;
+    if(!is_finite(fx)){
+        return scope.done(SystemResult<N>{x, 0, false, INFINITY, INFINITY, evaluations, jacobians});
+    }
+    for(int k = 1; k <= max_inter; k++){
+        Matrix<N> A = jacobian(x);
+        jacobians++;
+        int perm[N];
+        // Jacobiana singular: o passo não existe, e o método para sem convergência
+        if(!lu_decompose(A, perm)){
+            metrics::check_division(method, 0);
+            return scope.done(SystemResult<N>{x, k, false, norm_inf(fx), step, evaluations, jacobians});
+        }
+        Vector<N> dx = lu_solve(A, perm, fx), xn;
+        for(int i = 0; i < N; i++){
+            xn[i] = x[i] - dx[i]; // xk = xk-1 - J(xk-1)^-1 F(xk-1)
+        }
+        Vector<N> fn = f(xn);
+        evaluations++;
+        // Mesma salvaguarda de newton_raphson: para na última aproximação finita
+        if(!is_finite(xn) || !is_finite(fn)){
+            return scope.done(SystemResult<N>{x, k, false, norm_inf(fx), INFINITY, evaluations, jacobians});
+        }
+        step = norm_inf(dx);
+        x = xn;
+        fx = fn;
+        if(step < epsilon){
+            return scope.done(SystemResult<N>{x, k, true, norm_inf(fx), step, evaluations, jacobians});
+        }
+    }
+    return scope.done(SystemResult<N>{x, max_inter, false, norm_inf(fx), step, evaluations, jacobians});
+}
+
+// Inversa da jacobiana em H; false se ela é singular
+template <int N>
+bool invert(Matrix<N> A, Matrix<N>& H){
+    int perm[N];
+    if(!lu_decompose(A, perm)){
+        return false;
+    }
+    for(int j = 0; j < N; j++){
+        Vector<N> e{};
+        e[j] = 1;
+        Vector<N> c = lu_solve(A, perm, e);
+        for(int i = 0; i < N; i++){
+            H(i, j) = c[i];
+        }
+    }
+    return true;
+}
+
+// Broyden com a jacobiana de jacobian(x, fx, evaluations) no início e nos recomeços
+template <int N, class F, class J>
+SystemResult<N> broyden(F& f, J&& jacobian, Vector<N> x, double epsilon, int max_inter){
+    metrics::Scope scope(metrics::SYSTEM_BROYDEN);
+    Vector<N> fx = f(x);
+    int evaluations = 1, jacobians = 1;
+    double step = INFINITY;
+    Matrix<N> H;
+    if(!is_finite(fx) || !invert(jacobian(x, fx, evaluations), H)){
+        return scope.done(SystemResult<N>{x, 0, false, norm_inf(fx), INFINITY, evaluations, jacobians});
+    }
+    for(int k = 1; k <= max_inter; k++){
+        Vector<N> dx = multiply(H, fx), xn;
+        for(int i = 0; i < N; i++){
+            dx[i] = -dx[i];
+            xn[i] = x[i] + dx[i]; // xk = xk-1 - Hk-1 F(xk-1)
+        }
+        Vector<N> fn = f(xn);
+        evaluations++;
+        if(!is_finite(xn) || !is_finite(fn)){
+            return scope.done(SystemResult<N>{x, k, false, norm_inf(fx), INFINITY, evaluations, jacobians});
+        }
+        Vector<N> df;
+        for(int i = 0; i < N; i++){
+            df[i] = fn[i] - fx[i];
+        }
+        step = norm_inf(dx);
+        x = xn;
+        fx = fn;
+        if(step < epsilon){
+            return scope.done(SystemResult<N>{x, k, true, norm_inf(fx), step, evaluations, jacobians});
+        }
+
+        // Atualização de posto 1 da inversa: H += (dx - H df) (dx^T H) / (dx^T H df)
+        Vector<N> hdf = multiply(H, df), u, w;
+        double denominator = 0;
+        for(int i = 0; i < N; i++){
+            denominator += dx[i] * hdf[i];
+            u[i] = dx[i] - hdf[i];
+        }
+        for(int j = 0; j < N; j++){
+            double s = 0;
+            for(int i = 0; i < N; i++){
+                s += dx[i] * H(i, j);
+            }
+            w[j] = s;
+        }
+        metrics::check_division(metrics::SYSTEM_BROYDEN, denominator);
+        if(std::isfinite(denominator) && std::abs(denominator) > DBL_EPSILON * norm_inf(dx) * norm_inf(hdf)){
+            for(int i = 0; i < N; i++){
+                for(int j = 0; j < N; j++){
+                    H(i, j) += u[i] * w[j] / denominator;
+                }
+            }
+        }else{
+            // Atualização degenerada: recomeça com a jacobiana em xk
+            jacobians++;
+            if(!invert(jacobian(x, fx, evaluations), H)){
+                return scope.done(SystemResult<N>{x, k, false, norm_inf(fx), step, evaluations, jacobians});
+            }
+        }
+    }
+    return scope.done(SystemResult<N>{x, max_inter, false, norm_inf(fx), step, evaluations, jacobians});
+}
+
+} // namespace detail
+
+template <int N, class F, class J>
+SystemResult<N> newton(F&& f, J&& jacobian, const Vector<N>& x0, double epsilon=1e-5, int max_inter=100){
+    /*
+    Método de Newton para F(x) = 0: xk = xk-1 - J(xk-1)^-1 F(xk-1), com o sistema resolvido por LU.
+
+    Args:
+        (F&&) f: Função Vector<N> f(const Vector<N>&)
+        (J&&) jacobian: Função Matrix<N> jacobian(const Vector<N>&), com J(i, j) = dFi/dxj
+        (const Vector<N>&) x0: Aproximação inicial
+        (double) epsilon: Valor de tolerância mínimo para ||xk - xk-1||∞ (precisão)
+        (int) max_inter: Quantidade máxima de interações
+
+    Returns:
+        (SystemResult<N>): A raíz e informações relevantes do cálculo. Com a jacobiana singular, ou com xk ou F(xk)
+        não finitos, para sem convergência na última aproximação finita
+    */
+    return detail::newton(f, jacobian, x0, epsilon, max_inter, metrics::SYSTEM_NEWTON);
+}
+
+template <int N, class F>
+SystemResult<N> newton_ad(F&& f, const Vector<N>& x0, double epsilon=1e-5, int max_inter=100){
+    /*
+    Mesmo método de newton, com a jacobiana obtida por diferenciação automática. f deve ser genérica no tipo
+    escalar (chamada com Vector<N> e com Vector<N, ad::Dual>), como nos métodos escalares de generic_solvers.hpp.
+    Cada jacobiana custa N avaliações de f em números duais, contadas em jacobian_evaluations.
+    */
+    return detail::newton(f, [&f](const Vector<N>& x){ return jacobian_ad(f, x); }, x0, epsilon, max_inter,
+                          metrics::SYSTEM_NEWTON_AD);
+}
+
+template <int N, class F>
+SystemResult<N> broyden(F&& f, const Vector<N>& x0, double epsilon=1e-5, int max_inter=100){
+    /*
+    Método de Broyden para F(x) = 0: xk = xk-1 - Hk-1 F(xk-1), com H a inversa aproximada da jacobiana, corrigida a
+    cada interação pela atualização de posto 1 que faz H (F(xk) - F(xk-1)) = xk - xk-1. Cada interação custa uma
+    avaliação de F e O(N^2) operações, contra N avaliações (ou uma jacobiana) e uma LU O(N^3) de newton; em troca,
+    a convergência é superlinear em vez de quadrática.
+
+    A jacobiana inicial vem de diferenças progressivas em x0 (N avaliações de F), e é recalculada só se a
+    atualização degenerar (dx^T H df nulo).
+
+    Args:
+        (F&&) f: Função Vector<N> f(const Vector<N>&)
+        (const Vector<N>&) x0: Aproximação inicial
+        (double) epsilon: Valor de tolerância mínimo para ||xk - xk-1||∞ (precisão)
+        (int) max_inter: Quantidade máxima de interações
+
+    Returns:
+        (SystemResult<N>): A raíz e informações relevantes do cálculo
+    */
+    return detail::broyden(f, [&f](const Vector<N>& x, const Vector<N>& fx, int& evaluations){
+        evaluations += N;
+        return jacobian_fd(f, x, fx);
+    }, x0, epsilon, max_inter);
+}
+
+template <int N, class F, class J>
+SystemResult<N> broyden(F&& f, J&& jacobian, const Vector<N>& x0, double epsilon=1e-5, int max_inter=100){
+    /*
+    Mesmo método, com a jacobiana inicial (e a dos recomeços) dada por Matrix<N> jacobian(const Vector<N>&) em vez
+    de diferenças finitas.
+    */
+    return detail::broyden(f, [&jacobian](const Vector<N>& x, const Vector<N>&, int&){ return jacobian(x); },
+                           x0, epsilon, max_inter);
+}
+
+} // namespace nd
+
+#endif
@@ -1,4 +1,15 @@
-#include "root_finders.cpp"
+#include "root_finders.hpp"
+#include "generic_solvers.hpp"
+#include "thread_pool.hpp"
+#include "root_isolation.hpp"
+#include "continuation.hpp"
+#include "rocket_family.hpp"
+#include "expression.hpp"
+#include "result_file.hpp"
+#include "metrics.hpp"
+#include "portfolio.hpp"
+#include "sweep.hpp"
+#include "numeric_boards.hpp"
 #include <iostream>
 #include <fstream>
 #include <vector>
@@ -7,11 +18,20 @@
 #include <cmath>
 #include <iomanip>
 #include <algorithm>
+#include <cstring>
+#include <thread>
+#include <cstdio>
+#include <cstdlib>
+#include <charconv>
+#include <cctype>
+#include <memory>
 
 using namespace std;
 
 /*
-- fa retorna a função dada de acordo com o valor de 'a', dfa retorna a derivada de fa.
+- fa, newton_fa, foguete e barramento vêm de numeric_boards.hpp (os mesmos do módulo WASM e do addon nativo): fa
+retorna a função dada de acordo com o valor de 'a', e newton_fa aplica o Newton-Raphson a ela, com a derivada
+obtida por diferenciação automática (foguete) ou simbolicamente (funcao_usuario)
 - os métodos com '2' no final são adaptações dos métodos originais, seja adicionando um critério de parada que não
 tinha ou só tirando o bool responsável pelos prints
 - os métodos com 'results' no fim do nome retornam o Results, mas são principalmente uma modificação dos métodos com '2' no fim
@@ -29,67 +49,166 @@ vector<string> resultToVecString(Result x){
     return v;
 }
 
-function<double(double)> fa(double a){
-    return [a](double d){
-        return a*d - d*log(d);
-    };
+// Expressão de f nas variáveis a e d fornecida com --funcao (vazia: fa(a) = ad - dln(d))
+string funcao_usuario;
+
+// Barramento [r - δ, r + δ] com troca de sinal em volta de uma raíz exata r, com δ dobrando a partir de
+// 1e-9*(hi - lo) até no máximo 1e-3*(hi - lo). Devolve false se f não troca de sinal em volta de r (multiplicidade par)
+bool barramento_em_volta(const function<double(double)>& f, double r, double lo, double hi, Bracket& intervalo){
+    for(double delta = 1e-9 * (hi - lo); delta <= 1e-3 * (hi - lo); delta *= 2){
+        double a = r - delta, b = r + delta, fa = f(a), fb = f(b);
+        if(isfinite(fa) && isfinite(fb) && fa * fb < 0){
+            intervalo = {a, b, fa, fb};
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+Barramentos encontrados automaticamente (root_isolation.hpp) para cada valor de a, varrendo o domínio [lo, hi] em
+paralelo. Raízes exatas sobre a grade da varredura viram um barramento estreito em volta delas. Quando a varredura
+não encontra troca de sinal, é usado o barramento fixo de barramento().
+*/
+vector<Bracket> barramentos_automaticos(const vector<double>& a_foguetes, double lo, double hi, int n_threads){
+    vector<Bracket> intervalos;
+    WorkStealingPool pool(n_threads);
+    for(double a: a_foguetes){
+        function<double(double)> f = fa(funcao_usuario, a);
+        vector<Bracket> encontrados = find_brackets(f, lo, hi, pool);
+        // Raízes exatas sobre a grade (a = b) não servem diretamente aos métodos de barramento
+        vector<Bracket> validos;
+        for(const Bracket& br: encontrados){
+            Bracket intervalo = br;
+            if(br.a != br.b || barramento_em_volta(f, br.a, lo, hi, intervalo)){
+                validos.push_back(intervalo);
+            }else{
+                cerr << "a = " << a << ": raíz exata em " << br.a << " sem troca de sinal em volta, ignorada\n";
+            }
+        }
+        encontrados = validos;
+        if(encontrados.empty()){
+            double a_barramento, b_barramento, x0;
+            barramento(a, a_barramento, b_barramento, x0);
+            cerr << "a = " << a << ": nenhuma troca de sinal em [" << lo << ", " << hi << "], usando [" << a_barramento << ", " << b_barramento << "]\n";
+            intervalos.push_back({a_barramento, b_barramento, f(a_barramento), f(b_barramento)});
+        }else{
+            if(encontrados.size() > 1){
+                cerr << "a = " << a << ": " << encontrados.size() << " trocas de sinal encontradas, usando a primeira\n";
+            }
+            intervalos.push_back(encontrados[0]);
+        }
+    }
+    return intervalos;
+}
+
+/*
+Barramentos e aproximações iniciais obtidos por continuação (continuation.hpp): os valores de a são percorridos em
+ordem crescente e cada ponto parte da raíz prevista a partir do anterior, com recomeço a partir de barramento()
+quando o preditor falha.
+*/
+template <class Family>
+void sementes_continuacao(const Family& familia, const vector<double>& a_foguetes, double error, int max_iter, vector<Bracket>& intervalos, vector<double>& x0s){
+    BatchResult resultados;
+    int recomecos_newton = sweep_newton_raphson(familia, a_foguetes.data(), a_foguetes.size(),
+        [](double a){ return pow((double)2.7, a); }, error, max_iter, resultados, &x0s);
+    int recomecos_brent = sweep_brent(familia, a_foguetes.data(), a_foguetes.size(),
+        [](double a, double& lo, double& hi){ double x0; barramento(a, lo, hi, x0); }, error, max_iter, resultados, &intervalos);
+    cerr << "Continuação: " << recomecos_newton << " recomeço(s) no Newton-Raphson, " << recomecos_brent << " nos barramentos\n";
 }
 
-function<double(double)> dfa(double a){
-    return [a](double d){
-        return a - log(d) - 1;
+// Se resultados não é nulo, os Result dos quatro métodos (na ordem das colunas) também são copiados para ele
+vector<vector<string>> quadro(double a, double error, int max_iter, bool verbose, const Bracket* intervalo = nullptr, const double* x0_inicial = nullptr, Result* resultados = nullptr){
+    double a_barramento, b_barramento, x0;
+    barramento(a, a_barramento, b_barramento, x0);
+    if(intervalo){
+        a_barramento = intervalo->a;
+        b_barramento = intervalo->b;
+    }
+    if(x0_inicial){
+        x0 = *x0_inicial;
+    }
+
+    /*Um board tem o seguinte formato:
+    vec_text vec_bissection vec_false_pos vec_new_raph vec_brent
+    | a_i           | bisecção      | posição falsa | Newton Raphson | Brent  |
+    | Dados Iniciais| [A, B]        | [A, B]        | x0 = value     | [A, B] |
+    | x             |               |               |                |        |
+    | f(x)          |               |               |                |        |
+    | Erro          |               |               |                |        |
+    | Num Inter     |               |               |                |        |
+    */
+
+    vector<vector<string>> comp_board = {};
+    vector<string> vec_text = {"a = " + to_string(a), "Dados Iniciais", "x", "f(x)", "Erro", "Convergiu", "Numero de Interações"};
+    vector<string> vec_bissection = {"Bissecção", "[" + to_string(a_barramento)+ "," + to_string(b_barramento) + "]"};
+    vector<string> vec_false_pos = {"Posição Falsa", "[" + to_string(a_barramento) + "," + to_string(b_barramento) + "]"};
+    vector<string> vec_new_raph = {"Newton Raphson", "x_0 = " + to_string(x0)};
+    vector<string> vec_brent = {"Brent", "[" + to_string(a_barramento) + "," + to_string(b_barramento) + "]"};
+
+    Result r[4] = {
+        bisection(fa(funcao_usuario, a), a_barramento, b_barramento, error, max_iter, verbose),
+        false_position(fa(funcao_usuario, a), a_barramento, b_barramento, error, max_iter, verbose),
+        newton_fa(funcao_usuario, a, x0, error, max_iter),
+        brent(fa(funcao_usuario, a), a_barramento, b_barramento, error, max_iter, verbose)
     };
+    if(resultados){
+        copy(r, r + 4, resultados);
+    }
+    vector<string> bissection_result = resultToVecString(r[0]);
+    vector<string> false_pos_result = resultToVecString(r[1]);
+    vector<string> new_raph_result = resultToVecString(r[2]);
+    vector<string> brent_result = resultToVecString(r[3]);
+
+    vec_bissection.insert(vec_bissection.end(), bissection_result.begin(), bissection_result.end());
+    vec_false_pos.insert(vec_false_pos.end(), false_pos_result.begin(), false_pos_result.end());
+    vec_new_raph.insert(vec_new_raph.end(), new_raph_result.begin(), new_raph_result.end());
+    vec_brent.insert(vec_brent.end(), brent_result.begin(), brent_result.end());
+
+    comp_board.push_back(vec_text);
+    comp_board.push_back(vec_bissection);
+    comp_board.push_back(vec_false_pos);
+    comp_board.push_back(vec_new_raph);
+    comp_board.push_back(vec_brent);
+
+    return comp_board;
 }
 
-vector<vector<vector<string>>> quadro_comparativo(vector<double> a_foguetes, double error, int max_iter){
+// resultados (opcional) recebe 4 Result por valor de a, na ordem das colunas do quadro
+vector<vector<vector<string>>> quadro_comparativo(vector<double> a_foguetes, double error, int max_iter, const vector<Bracket>& intervalos = {}, const vector<double>& x0s = {}, vector<Result>* resultados = nullptr){
     vector<vector<vector<string>>> boards;
+    if(resultados){
+        resultados->resize(4 * a_foguetes.size());
+    }
 
     for(int i = 0; i < a_foguetes.size(); i++){
-        /*A solução da equação ad - dln(d) é d = e^a,
-        seja [A,B] o barramento, então devemos ter A <= e^a e e^B >= e^b
-        para que seja possível a convergencia
-        Portanto, usaremos o barramento [2^a,3^a] se a > 0 e [3^a, 2^a] se a < 0
-        No caso do Newton-Raphson, podemos utilizar o valor inicial de x0 = 2.7^a, ja que é proximo do valor de e^a
-        */
-
-        double a_barramento = a_foguetes[i] < 0 ? pow((double)3, a_foguetes[i]) : pow((double)2, a_foguetes[i]);
-        double b_barramento = a_foguetes[i] < 0 ? pow((double)2, a_foguetes[i]) : pow((double)3, a_foguetes[i]);
-        a_barramento = a_foguetes[i] == 0 ?  0.98 : a_barramento;
-        b_barramento =  a_foguetes[i] == 0 ?  1.02 : b_barramento;
-        double x0 = pow((double)2.7, a_foguetes[i]);
-
-        /*Um board tem o seguinte formato:
-        vec_text vec_bissection vec_false_pos vec_new_raph
-        | a_i           | bisecção      | posição falsa | Newton Raphson |
-        | Dados Iniciais| [A, B]        | [A, B]        | x0 = value     |
-        | x             |               |               |                |
-        | f(x)          |               |               |                |
-        | Erro          |               |               |                |
-        | Num Inter     |               |               |                |
-        */
-
-        vector<vector<string>> comp_board = {};
-        vector<string> vec_text = {"a = " + to_string(a_foguetes[i]), "Dados Iniciais", "x", "f(x)", "Erro", "Convergiu", "Numero de Interações"};
-        vector<string> vec_bissection = {"Bissecção", "[" + to_string(a_barramento)+ "," + to_string(b_barramento) + "]"};
-        vector<string> vec_false_pos = {"Posição Falsa", "[" + to_string(a_barramento) + "," + to_string(b_barramento) + "]"};
-        vector<string> vec_new_raph = {"Newton Raphson", "x_0 = " + to_string(x0)};
-
-        vector<string> bissection_result = resultToVecString(bisection(fa(a_foguetes[i]), a_barramento, b_barramento, error, max_iter, true));
-        vector<string> false_pos_result = resultToVecString(false_position(fa(a_foguetes[i]), a_barramento, b_barramento, error, max_iter, true));
-        vector<string> new_raph_result = resultToVecString(newton_raphson(fa(a_foguetes[i]), dfa(a_foguetes[i]), x0, error, max_iter));
-
-        vec_bissection.insert(vec_bissection.end(), bissection_result.begin(), bissection_result.end());
-        vec_false_pos.insert(vec_false_pos.end(), false_pos_result.begin(), false_pos_result.end());
-        vec_new_raph.insert(vec_new_raph.end(), new_raph_result.begin(), new_raph_result.end());
-
-        comp_board.push_back(vec_text);
-        comp_board.push_back(vec_bissection);
-        comp_board.push_back(vec_false_pos);
-        comp_board.push_back(vec_new_raph);
-
-        boards.push_back(comp_board);
+        boards.push_back(quadro(a_foguetes[i], error, max_iter, true, intervalos.empty() ? nullptr : &intervalos[i], x0s.empty() ? nullptr : &x0s[i],
+            resultados ? &(*resultados)[4 * i] : nullptr));
+    }
+
+    return boards;
+}
+
+/*
+Versão paralela de quadro_comparativo: os quadros são independentes, então cada um vira uma tarefa de um
+WorkStealingPool com n_threads threads. Cada quadro é escrito na sua própria posição do vetor de saída, logo a
+ordem (e o conteúdo impresso por print_boards) é idêntica à da versão serial. Os prints de iteração (verbose)
+ficam desligados, pois seriam intercalados entre as threads.
+*/
+vector<vector<vector<string>>> quadro_comparativo_paralelo(vector<double> a_foguetes, double error, int max_iter, int n_threads, const vector<Bracket>& intervalos = {}, const vector<double>& x0s = {}, vector<Result>* resultados = nullptr){
+    vector<vector<vector<string>>> boards(a_foguetes.size());
+    WorkStealingPool pool(n_threads);
+    if(resultados){
+        resultados->resize(4 * a_foguetes.size());
     }
 
+    // Blocos pequenos o suficiente para que as threads ociosas tenham o que roubar
+    size_t grain = max<size_t>(1, a_foguetes.size() / (8 * pool.size()));
+    pool.parallel_for(a_foguetes.size(), grain, [&](size_t i){
+        boards[i] = quadro(a_foguetes[i], error, max_iter, false, intervalos.empty() ? nullptr : &intervalos[i], x0s.empty() ? nullptr : &x0s[i],
+            resultados ? &(*resultados)[4 * i] : nullptr);
+    });
+
     return boards;
 }
 
@@ -143,7 +262,441 @@ void print_boards(const vector<vector<vector<string>>>& boards, ostream& output)
     }
 }
 
-int main(){
+/*
+Modo em lote (--lote), para milhões de valores de a sem prompts nem tabelas de strings. Os valores são lidos de
+--entrada ARQUIVO (ou da entrada padrão), separados por espaços, quebras de linha, vírgulas ou ponto e vírgula, e cada
+um gera uma linha de saída, na mesma ordem, em CSV (padrão) ou NDJSON (--formato ndjson), escrita em --saida ARQUIVO
+(ou na saída padrão). Com --formato binario a saída é o arquivo colunar de result_file.hpp (uma linha por valor de a
+e método, exige --saida). A entrada é processada em blocos de TAMANHO_BLOCO_LOTE valores: cada bloco é resolvido (em
+paralelo com --threads) e escrito antes de o próximo ser lido, então a memória usada não depende do tamanho da entrada.
+
+A precisão e o número máximo de iterações vêm de --epsilon (padrão 1e-5) e --max-iter (padrão 100). Os métodos são os
+mesmos do quadro comparativo, com os barramentos e x0 de barramento(); se f não troca de sinal no barramento (o que
+pode acontecer com --funcao), os métodos de barramento dão raíz NaN e convergiu = false.
+
+Com --portfolio, cada valor de a é resolvido uma única vez por portfolio::solve (portfolio.hpp), com os mesmos
+barramentos e x0, e a linha tem só o resultado do vencedor e o nome dele (coluna method; "none" se nenhum membro
+produziu uma aproximação). No formato binário, o método de cada linha é o vencedor.
+*/
+const size_t TAMANHO_BLOCO_LOTE = 4096;
+const int METODOS_LOTE = 4;
+const char* NOMES_LOTE[METODOS_LOTE] = {"bisection", "false_position", "newton_raphson", "brent"};
+
+enum FormatoLote { LOTE_CSV, LOTE_NDJSON, LOTE_BINARIO };
+
+struct LinhaLote {
+    double a;
+    Result r[METODOS_LOTE];
+    int vencedor;  // Só com --portfolio: membro vencedor (portfolio::Member, ou portfolio::MEMBERS se nenhum)
+};
+
+const char* nome_vencedor(int vencedor){
+    return vencedor < portfolio::MEMBERS ? portfolio::MEMBER_NAMES[vencedor] : "none";
+}
+
+// Leitura de números de um FILE* com um buffer fixo, sem alocar por valor
+class LeitorNumeros {
+public:
+    explicit LeitorNumeros(FILE* arquivo) : arquivo_(arquivo), buffer_(1 << 16) {}
+
+    // Lê o próximo número em x; retorna false no fim da entrada. Lança invalid_argument se o texto não é um número
+    bool proximo(double& x){
+        int c = get();
+        while(c != EOF && (isspace(c) || c == ',' || c == ';')){
+            c = get();
+        }
+        if(c == EOF){
+            return false;
+        }
+        token_.clear();
+        while(c != EOF && !(isspace(c) || c == ',' || c == ';')){
+            token_.push_back((char)c);
+            c = get();
+        }
+        const char* fim = token_.data() + token_.size();
+        auto [ptr, ec] = from_chars(token_.data() + (token_[0] == '+'), fim, x);
+        if(ec != errc() || ptr != fim){
+            throw invalid_argument("Valor de a inválido na entrada: '" + token_ + "'");
+        }
+        return true;
+    }
+
+private:
+    FILE* arquivo_;
+    vector<char> buffer_;
+    size_t pos_ = 0, fim_ = 0;
+    string token_;
+
+    int get(){
+        if(pos_ == fim_){
+            fim_ = fread(buffer_.data(), 1, buffer_.size(), arquivo_);
+            pos_ = 0;
+            if(fim_ == 0){
+                return EOF;
+            }
+        }
+        return (unsigned char)buffer_[pos_++];
+    }
+};
+
+template <class F, class DF>
+void resolve_lote(const F& f, const DF& df, LinhaLote& linha, double error, int max_iter){
+    double a_barramento, b_barramento, x0;
+    barramento(linha.a, a_barramento, b_barramento, x0);
+    bool troca_sinal = f(a_barramento) * f(b_barramento) < 0;
+    Result invalido = {NAN, 0, false, NAN, NAN, 0};
+    linha.r[0] = troca_sinal ? generic::bisection(f, a_barramento, b_barramento, error, max_iter) : invalido;
+    linha.r[1] = troca_sinal ? generic::false_position(f, a_barramento, b_barramento, error, max_iter) : invalido;
+    linha.r[2] = generic::newton_raphson(f, df, x0, error, max_iter);
+    linha.r[3] = troca_sinal ? generic::brent(f, a_barramento, b_barramento, error, max_iter) : invalido;
+}
+
+template <class F, class DF>
+void resolve_lote_portfolio(const F& f, const DF& df, LinhaLote& linha, double error, int max_iter){
+    double a_barramento, b_barramento, x0;
+    barramento(linha.a, a_barramento, b_barramento, x0);
+    portfolio::PortfolioResult p = portfolio::solve(f, df, a_barramento, b_barramento, x0, error, max_iter);
+    linha.r[0] = p.result;
+    linha.vencedor = p.winner >= 0 ? p.winner : portfolio::MEMBERS;
+}
+
+void escreve_numero(string& saida, double x, bool json){
+    if(json && !isfinite(x)){
+        saida += "null";
+        return;
+    }
+    // Menor representação que relê o mesmo double, bem mais rápida que printf("%.17g")
+    char buffer[32];
+    char* fim = to_chars(buffer, buffer + sizeof buffer, x).ptr;
+    saida.append(buffer, fim - buffer);
+}
+
+void escreve_linha_lote(string& saida, const LinhaLote& linha, bool json, bool com_portfolio){
+    const int metodos = com_portfolio ? 1 : METODOS_LOTE;
+    if(json){
+        saida += "{\"a\":";
+        escreve_numero(saida, linha.a, true);
+        for(int m = 0; m < metodos; m++){
+            const Result& r = linha.r[m];
+            saida += ",\"";
+            saida += com_portfolio ? "portfolio" : NOMES_LOTE[m];
+            saida += "\":{\"root\":";
+            escreve_numero(saida, r.root, true);
+            saida += ",\"residual\":";
+            escreve_numero(saida, r.residual, true);
+            saida += ",\"error\":";
+            escreve_numero(saida, r.error, true);
+            saida += r.converged ? ",\"converged\":true" : ",\"converged\":false";
+            saida += ",\"interations\":" + to_string(r.interations);
+            saida += ",\"function_evaluations\":" + to_string(r.function_evaluations);
+            if(com_portfolio){
+                saida += string(",\"method\":\"") + nome_vencedor(linha.vencedor) + "\"";
+            }
+            saida += "}";
+        }
+        saida += "}\n";
+        return;
+    }
+    escreve_numero(saida, linha.a, false);
+    for(int m = 0; m < metodos; m++){
+        const Result& r = linha.r[m];
+        saida += ',';
+        escreve_numero(saida, r.root, false);
+        saida += ',';
+        escreve_numero(saida, r.residual, false);
+        saida += ',';
+        escreve_numero(saida, r.error, false);
+        saida += r.converged ? ",1," : ",0,";
+        saida += to_string(r.interations) + ',' + to_string(r.function_evaluations);
+    }
+    if(com_portfolio){
+        saida += ',';
+        saida += nome_vencedor(linha.vencedor);
+    }
+    saida += '\n';
+}
+
+int modo_lote(const char* entrada, const char* arquivo_saida, FormatoLote formato, double error, int max_iter, int n_threads,
+              bool com_portfolio){
+    const bool json = formato == LOTE_NDJSON;
+    if(formato == LOTE_BINARIO && !arquivo_saida){
+        cerr << "--formato binario exige --saida ARQUIVO\n";
+        return 1;
+    }
+    FILE* in = entrada ? fopen(entrada, "rb") : stdin;
+    if(!in){
+        cerr << "Não foi possível abrir " << entrada << "\n";
+        return 1;
+    }
+    unique_ptr<ResultFileWriter> binario;
+    FILE* out = nullptr;
+    if(formato == LOTE_BINARIO){
+        vector<string> nomes(NOMES_LOTE, NOMES_LOTE + METODOS_LOTE);
+        if(com_portfolio){
+            nomes.assign(portfolio::MEMBER_NAMES, portfolio::MEMBER_NAMES + portfolio::MEMBERS);
+            nomes.push_back("none");
+        }
+        binario = make_unique<ResultFileWriter>(arquivo_saida, nomes);
+    }else{
+        out = arquivo_saida ? fopen(arquivo_saida, "wb") : stdout;
+        if(!out){
+            cerr << "Não foi possível criar " << arquivo_saida << "\n";
+            return 1;
+        }
+    }
+
+    string saida;
+    if(formato == LOTE_CSV){
+        saida = "a";
+        for(int m = 0; m < (com_portfolio ? 1 : METODOS_LOTE); m++){
+            for(const char* campo: {"root", "residual", "error", "converged", "interations", "function_evaluations"}){
+                saida += string(",") + (com_portfolio ? "portfolio" : NOMES_LOTE[m]) + "_" + campo;
+            }
+        }
+        saida += com_portfolio ? ",portfolio_method\n" : "\n";
+    }
+
+    // Com --funcao, a expressão é compilada uma única vez nas variáveis a e d
+    unique_ptr<ExpressionFamily> familia;
+    if(!funcao_usuario.empty()){
+        familia = make_unique<ExpressionFamily>(funcao_usuario, "a", "d");
+    }
+    auto resolve = [&](LinhaLote& linha){
+        double a = linha.a;
+        auto resolve_com = [&](const auto& f, const auto& df){
+            if(com_portfolio){
+                resolve_lote_portfolio(f, df, linha, error, max_iter);
+            }else{
+                resolve_lote(f, df, linha, error, max_iter);
+            }
+        };
+        if(familia){
+            const ExpressionFamily& fam = *familia;
+            resolve_com([&fam, a](double d){ return fam.f(a, d); }, [&fam, a](double d){ return fam.df(a, d); });
+        }else{
+            resolve_com(foguete(a), [a](double d){ return a - log(d) - 1; });
+        }
+    };
+
+    unique_ptr<WorkStealingPool> pool;
+    if(n_threads > 0){
+        pool = make_unique<WorkStealingPool>(n_threads);
+    }
+    LeitorNumeros leitor(in);
+    vector<LinhaLote> bloco(TAMANHO_BLOCO_LOTE);
+    int status = 0;
+    while(true){
+        size_t n = 0;
+        try{
+            while(n < bloco.size() && leitor.proximo(bloco[n].a)){
+                n++;
+            }
+        }catch(const invalid_argument& erro){
+            cerr << erro.what() << "\n";
+            status = 1;
+        }
+        if(pool){
+            pool->parallel_for(n, max<size_t>(1, n / (8 * pool->size())), [&](size_t i){ resolve(bloco[i]); });
+        }else{
+            for(size_t i = 0; i < n; i++){
+                resolve(bloco[i]);
+            }
+        }
+        if(binario){
+            for(size_t i = 0; i < n; i++){
+                if(com_portfolio){
+                    binario->append(bloco[i].a, bloco[i].vencedor, bloco[i].r[0]);
+                    continue;
+                }
+                for(int m = 0; m < METODOS_LOTE; m++){
+                    binario->append(bloco[i].a, m, bloco[i].r[m]);
+                }
+            }
+        }else{
+            for(size_t i = 0; i < n; i++){
+                escreve_linha_lote(saida, bloco[i], json, com_portfolio);
+            }
+            fwrite(saida.data(), 1, saida.size(), out);
+            saida.clear();
+        }
+        if(n < bloco.size() || status != 0){
+            break;
+        }
+    }
+
+    if(entrada){
+        fclose(in);
+    }
+    if(binario){
+        binario->close();
+    }else if(arquivo_saida){
+        fclose(out);
+    }else{
+        fflush(out);
+    }
+    return status;
+}
+
+#ifndef _WIN32
+/*
+Varredura em vários processos (--varredura A0 A1 N): os mesmos métodos e barramentos do modo em lote para N valores
+de a igualmente espaçados em [A0, A1], escritos no arquivo colunar --saida ARQUIVO por --processos P processos (padrão:
+núcleos da máquina) em blocos de --bloco S valores. Uma varredura interrompida é retomada ao rodar o mesmo comando
+(ver sweep.hpp).
+*/
+int modo_varredura(const char* arquivo_saida, const SweepConfig& config){
+    if(!arquivo_saida){
+        cerr << "--varredura exige --saida ARQUIVO\n";
+        return 1;
+    }
+    // A expressão é compilada antes do fork, e cada processo herda a sua cópia
+    unique_ptr<ExpressionFamily> familia;
+    if(!funcao_usuario.empty()){
+        familia = make_unique<ExpressionFamily>(funcao_usuario, "a", "d");
+    }
+    return run_sweep(arquivo_saida, config, vector<string>(NOMES_LOTE, NOMES_LOTE + METODOS_LOTE), [&](double a, Result* r){
+        LinhaLote linha;
+        linha.a = a;
+        if(familia){
+            const ExpressionFamily& fam = *familia;
+            resolve_lote([&fam, a](double d){ return fam.f(a, d); }, [&fam, a](double d){ return fam.df(a, d); }, linha, config.epsilon, config.max_iter);
+        }else{
+            resolve_lote(foguete(a), [a](double d){ return a - log(d) - 1; }, linha, config.epsilon, config.max_iter);
+        }
+        copy(linha.r, linha.r + METODOS_LOTE, r);
+    });
+}
+#endif
+
+// Escreve o JSON de metrics::to_json() em arquivo ("-" para a saída de erro, que não se mistura com os resultados)
+void escreve_metricas(const char* arquivo){
+    if(!metrics::enabled){
+        cerr << "Aviso: compilado sem RF_METRICS (opção ROOTFINDERS_METRICS do CMake), métricas vazias\n";
+    }
+    if(strcmp(arquivo, "-") == 0){
+        cerr << metrics::to_json() << "\n";
+        return;
+    }
+    ofstream saida(arquivo);
+    if(!saida){
+        cerr << "Não foi possível criar " << arquivo << "\n";
+        return;
+    }
+    saida << metrics::to_json() << "\n";
+}
+
+int main(int argc, char** argv){
+    // Modo paralelo: --threads N (ou -t N). Com N = 0 usa todos os núcleos disponíveis
+    // Barramentos automáticos: --dominio LO HI varre [LO, HI] em busca do barramento de cada a
+    // Continuação: --continuacao parte cada a da raíz prevista a partir do valor de a anterior (em ordem crescente)
+    // Outra função: --funcao EXPR resolve EXPR = 0 em d (por exemplo "a*d - d*log(d)"), com a derivada calculada
+    // simbolicamente; os barramentos fixos de barramento() valem para fa(a), então combine com --dominio
+    // Lote: --lote [--entrada ARQUIVO] [--saida ARQUIVO] [--formato csv|ndjson] [--epsilon EPS] [--max-iter N] lê os
+    // valores de a sem prompts e escreve os resultados em fluxo (ver modo_lote); --formato binario usa result_file.hpp
+    // Portfólio: --portfolio (com --lote) resolve cada a com portfolio::solve e escreve só o vencedor
+    // Varredura: --varredura A0 A1 N --saida ARQUIVO [--processos P] [--bloco S] resolve N valores de a em [A0, A1] em
+    // vários processos, com checkpoint para retomar uma varredura interrompida (ver modo_varredura; não existe no Windows)
+    // Binário: --binario ARQUIVO salva também os resultados do quadro no arquivo colunar de result_file.hpp
+    // Métricas: --metricas ARQUIVO (ou -) escreve ao final os contadores de metrics.hpp em JSON, se compilado com RF_METRICS
+    int n_threads = -1;
+    bool dominio = false, continuacao = false;
+    double dominio_lo = 0, dominio_hi = 0;
+    bool lote = false, com_portfolio = false;
+    bool varredura = false;
+    SweepConfig config_varredura;
+    config_varredura.processes = max(1u, thread::hardware_concurrency());
+    FormatoLote formato = LOTE_CSV;
+    const char* entrada = nullptr;
+    const char* saida = nullptr;
+    const char* arquivo_binario = nullptr;
+    const char* arquivo_metricas = nullptr;
+    double epsilon_lote = 1e-5;
+    int max_iter_lote = 100;
+    for(int i = 1; i < argc; i++){
+        if((strcmp(argv[i], "--threads") == 0 || strcmp(argv[i], "-t") == 0) && i + 1 < argc){
+            n_threads = atoi(argv[++i]);
+            if(n_threads == 0){
+                n_threads = max(1u, thread::hardware_concurrency());
+            }
+        }else if(strcmp(argv[i], "--dominio") == 0 && i + 2 < argc){
+            dominio = true;
+            dominio_lo = atof(argv[++i]);
+            dominio_hi = atof(argv[++i]);
+        }else if(strcmp(argv[i], "--continuacao") == 0){
+            continuacao = true;
+        }else if(strcmp(argv[i], "--funcao") == 0 && i + 1 < argc){
+            funcao_usuario = argv[++i];
+        }else if(strcmp(argv[i], "--lote") == 0){
+            lote = true;
+        }else if(strcmp(argv[i], "--varredura") == 0 && i + 3 < argc){
+            varredura = true;
+            config_varredura.a0 = atof(argv[++i]);
+            config_varredura.a1 = atof(argv[++i]);
+            config_varredura.n = strtoull(argv[++i], nullptr, 10);
+        }else if(strcmp(argv[i], "--processos") == 0 && i + 1 < argc){
+            config_varredura.processes = max(1, atoi(argv[++i]));
+        }else if(strcmp(argv[i], "--bloco") == 0 && i + 1 < argc){
+            config_varredura.shard_size = (uint32_t)max(1, atoi(argv[++i]));
+        }else if(strcmp(argv[i], "--portfolio") == 0){
+            com_portfolio = true;
+        }else if(strcmp(argv[i], "--entrada") == 0 && i + 1 < argc){
+            entrada = argv[++i];
+        }else if(strcmp(argv[i], "--saida") == 0 && i + 1 < argc){
+            saida = argv[++i];
+        }else if(strcmp(argv[i], "--formato") == 0 && i + 1 < argc){
+            i++;
+            formato = strcmp(argv[i], "ndjson") == 0 ? LOTE_NDJSON : strcmp(argv[i], "binario") == 0 ? LOTE_BINARIO : LOTE_CSV;
+        }else if(strcmp(argv[i], "--binario") == 0 && i + 1 < argc){
+            arquivo_binario = argv[++i];
+        }else if(strcmp(argv[i], "--metricas") == 0 && i + 1 < argc){
+            arquivo_metricas = argv[++i];
+        }else if(strcmp(argv[i], "--epsilon") == 0 && i + 1 < argc){
+            epsilon_lote = atof(argv[++i]);
+        }else if(strcmp(argv[i], "--max-iter") == 0 && i + 1 < argc){
+            max_iter_lote = atoi(argv[++i]);
+        }
+    }
+    if(!funcao_usuario.empty()){
+        try{
+            ExpressionFamily validacao(funcao_usuario, "a", "d");
+        }catch(const invalid_argument& erro){
+            cerr << erro.what() << "\n";
+            return 1;
+        }
+    }
+    if(varredura){
+#ifdef _WIN32
+        cerr << "--varredura não é suportado no Windows\n";
+        return 1;
+#else
+        config_varredura.epsilon = epsilon_lote;
+        config_varredura.max_iter = max_iter_lote;
+        config_varredura.function = funcao_usuario;
+        try{
+            int status = modo_varredura(saida, config_varredura);
+            if(arquivo_metricas){
+                escreve_metricas(arquivo_metricas);
+            }
+            return status;
+        }catch(const runtime_error& erro){
+            cerr << erro.what() << "\n";
+            return 1;
+        }
+#endif
+    }
+    if(lote){
+        try{
+            int status = modo_lote(entrada, saida, formato, epsilon_lote, max_iter_lote, n_threads, com_portfolio);
+            if(arquivo_metricas){
+                escreve_metricas(arquivo_metricas);
+            }
+            return status;
+        }catch(const runtime_error& erro){
+            cerr << erro.what() << "\n";
+            return 1;
+        }
+    }
+
     // Ler tamanho do vetor
     int n;
     cout << "Digite o tamanho do vetor a_foguetes: ";
@@ -170,8 +723,24 @@ int main(){
     cout << "Digite a quantidade máxima de iterações: ";
     cin >> max_iter;
 
+    vector<Bracket> intervalos;
+    vector<double> x0s;
+    if(continuacao){
+        if(funcao_usuario.empty()){
+            sementes_continuacao(RocketFamily(), a_foguetes, error, max_iter, intervalos, x0s);
+        }else{
+            sementes_continuacao(ExpressionFamily(funcao_usuario, "a", "d"), a_foguetes, error, max_iter, intervalos, x0s);
+        }
+    }else if(dominio){
+        intervalos = barramentos_automaticos(a_foguetes, dominio_lo, dominio_hi, max(1, n_threads));
+    }
+
     // Gerar os quadros comparativos
-    vector<vector<vector<string>>> boards = quadro_comparativo(a_foguetes, error, max_iter);
+    vector<Result> resultados;
+    vector<Result>* destino = arquivo_binario ? &resultados : nullptr;
+    vector<vector<vector<string>>> boards = n_threads > 0
+        ? quadro_comparativo_paralelo(a_foguetes, error, max_iter, n_threads, intervalos, x0s, destino)
+        : quadro_comparativo(a_foguetes, error, max_iter, intervalos, x0s, destino);
 
     // Imprimir no terminal
     cout << "\n\n========================================\n";
@@ -202,5 +771,23 @@ int main(){
         cerr << "Erro ao criar arquivo de saída!\n";
     }
 
+    if(arquivo_binario){
+        try{
+            ResultFileWriter binario(arquivo_binario, vector<string>(NOMES_LOTE, NOMES_LOTE + METODOS_LOTE));
+            for(size_t i = 0; i < resultados.size(); i++){
+                binario.append(a_foguetes[i / 4], i % 4, resultados[i]);
+            }
+            binario.close();
+            cout << "Resultados salvos em '" << arquivo_binario << "'\n";
+        }catch(const runtime_error& erro){
+            cerr << erro.what() << "\n";
+            return 1;
+        }
+    }
+
+    if(arquivo_metricas){
+        escreve_metricas(arquivo_metricas);
+    }
+
     return 0;
 }
\ No newline at end of file
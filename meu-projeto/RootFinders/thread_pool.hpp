@@ -0,0 +1,198 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+Pool de threads com roubo de tarefas (work stealing). Cada thread possui sua própria fila: ela consome as tarefas
+do fim da própria fila e, quando fica sem trabalho, rouba tarefas do início da fila das outras. Tarefas podem
+submeter novas tarefas (que vão para a fila da thread que as criou).
+
+A thread que chama wait() também executa tarefas, de modo que um pool de n threads cria apenas n - 1 threads
+auxiliares. Com n = 1 nenhuma thread é criada e tudo roda na thread chamadora, em ordem de submissão inversa,
+o que também permite usar o pool em builds sem suporte a threads (WASM sem pthreads).
+*/
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(int n_threads)
+        : queues_(std::max(1, n_threads)) {
+        for(auto& q: queues_){
+            q.reset(new Queue());
+        }
+        for(int i = 1; i < (int)queues_.size(); i++){
+            threads_.emplace_back([this, i]{ worker_loop(i); });
+        }
+    }
+
+    ~WorkStealingPool(){
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for(auto& t: threads_){
+            t.join();
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    int size() const {
+        return (int)queues_.size();
+    }
+
+    // Índice da thread atual dentro do pool em que ela está rodando tarefas, em [0, size()); a thread que chama
+    // wait() é a 0. Serve para indexar buffers por thread
+    static int thread_index(){
+        return (int)current_index();
+    }
+
+    // Submete uma tarefa. Dentro de uma tarefa do próprio pool, ela entra na fila da thread atual
+    void submit(std::function<void()> task){
+        std::size_t index = current_pool() == this ? current_index() : next_queue_++ % queues_.size();
+        pending_++;
+        {
+            std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queued_++;
+        }
+        cv_.notify_one();
+    }
+
+    // Bloqueia até que todas as tarefas submetidas (inclusive as criadas por outras tarefas) terminem.
+    // Se alguma tarefa lançou uma exceção, a primeira delas é relançada aqui
+    void wait(){
+        WorkStealingPool* previous_pool = current_pool();
+        std::size_t previous_index = current_index();
+        current_pool() = this;
+        current_index() = 0;
+        while(pending_ > 0){
+            if(!run_one(0)){
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]{ return pending_ == 0 || queued_ > 0; });
+            }
+        }
+        current_pool() = previous_pool;
+        current_index() = previous_index;
+
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::swap(error, error_);
+        }
+        if(error){
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Executa body(i) para i em [0, n), em blocos de 'grain' índices distribuídos entre as threads
+    template <class Body>
+    void parallel_for(std::size_t n, std::size_t grain, Body&& body){
+        grain = std::max<std::size_t>(1, grain);
+        for(std::size_t begin = 0; begin < n; begin += grain){
+            std::size_t end = std::min(n, begin + grain);
+            submit([&body, begin, end]{
+                for(std::size_t i = begin; i < end; i++){
+                    body(i);
+                }
+            });
+        }
+        wait();
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::size_t queued_ = 0;               // Tarefas nas filas, ainda não iniciadas (protegido por mutex_)
+    std::atomic<std::size_t> pending_{0};  // Tarefas submetidas e ainda não concluídas
+    std::atomic<std::size_t> next_queue_{0};
+    bool stop_ = false;
+    std::exception_ptr error_;             // Primeira exceção lançada por uma tarefa (protegido por mutex_)
+
+    static WorkStealingPool*& current_pool(){
+        thread_local WorkStealingPool* pool = nullptr;
+        return pool;
+    }
+
+    static std::size_t& current_index(){
+        thread_local std::size_t index = 0;
+        return index;
+    }
+
+    // Retira uma tarefa da própria fila (pelo fim) ou rouba de outra (pelo início) e a executa
+    bool run_one(std::size_t self){
+        std::function<void()> task;
+        for(std::size_t k = 0; k < queues_.size() && !task; k++){
+            Queue& q = *queues_[(self + k) % queues_.size()];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if(q.tasks.empty()){
+                continue;
+            }
+            if(k == 0){
+                task = std::move(q.tasks.back());
+                q.tasks.pop_back();
+            }else{
+                task = std::move(q.tasks.front());
+                q.tasks.pop_front();
+            }
+        }
+        if(!task){
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queued_--;
+        }
+        try{
+            task();
+        }catch(...){
+            std::lock_guard<std::mutex> lock(mutex_);
+            if(!error_){
+                error_ = std::current_exception();
+            }
+        }
+        if(--pending_ == 0){
+            std::lock_guard<std::mutex> lock(mutex_);
+            cv_.notify_all();
+        }
+        return true;
+    }
+
+    void worker_loop(std::size_t self){
+        current_pool() = this;
+        current_index() = self;
+        while(true){
+            if(run_one(self)){
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]{ return stop_ || queued_ > 0; });
+            if(stop_ && queued_ == 0){
+                return;
+            }
+        }
+    }
+};
+
+#endif
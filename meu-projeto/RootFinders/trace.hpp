@@ -0,0 +1,59 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <cstddef>
+#include <vector>
+
+// Registro de uma iteração de um método. Todos os campos são double para que o buffer possa ser lido
+// diretamente como um Float64Array (4 valores por registro) no JS
+struct TraceRecord {
+    double k;     // Índice da iteração
+    double x;     // Aproximação da raíz na iteração
+    double fx;    // f(x) (no ponto fixo, phi(x))
+    double width; // Largura do intervalo (bissecção, posição falsa) ou tamanho do passo |xk - xk-1| (demais métodos)
+};
+
+/*
+Buffer de histórico das iterações, alternativa ao verbose que não usa iostream nem reavalia f. A capacidade é
+reservada na construção (ou em reserve) e record nunca aloca memória: quando o buffer enche, os registros
+excedentes são descartados e contados em dropped().
+
+Vários métodos podem escrever no mesmo buffer em sequência; o trecho de cada execução é delimitado pelo valor de
+size() antes e depois da chamada.
+*/
+class TraceBuffer {
+public:
+    explicit TraceBuffer(std::size_t capacity = 0){
+        reserve(capacity);
+    }
+
+    void reserve(std::size_t capacity){
+        records_.resize(capacity);
+    }
+
+    void clear(){
+        size_ = 0;
+        dropped_ = 0;
+    }
+
+    void record(int k, double x, double fx, double width){
+        if(size_ < records_.size()){
+            records_[size_++] = {(double)k, x, fx, width};
+        }else{
+            dropped_++;
+        }
+    }
+
+    std::size_t size() const { return size_; }
+    std::size_t capacity() const { return records_.size(); }
+    std::size_t dropped() const { return dropped_; }
+    const TraceRecord* data() const { return records_.data(); }
+    const TraceRecord& operator[](std::size_t i) const { return records_[i]; }
+
+private:
+    std::vector<TraceRecord> records_;
+    std::size_t size_ = 0;
+    std::size_t dropped_ = 0;
+};
+
+#endif
@@ -1,5 +1,7 @@
-import { app, BrowserWindow, nativeTheme } from 'electron'
+import { app, BrowserWindow, dialog, ipcMain, nativeTheme } from 'electron'
 import { fileURLToPath } from 'node:url'
+import { createRequire } from 'node:module'
+import { readFile } from 'node:fs/promises'
 import path from 'node:path'
 
 const __dirname = path.dirname(fileURLToPath(import.meta.url))
@@ -45,6 +47,88 @@ function createWindow() {
   })
 }
 
+// Addon nativo dos métodos (RootFinders/native_addon.cpp, npm run build:native). Roda os quadros em todos os núcleos,
+// sem o custo do embind; se não foi compilado ou não carrega nesta plataforma, o renderer usa o módulo WASM
+interface NativeAddon {
+  comparativeBoards: (a: Float64Array, epsilon: number, maxIter: number, trace: boolean, funcao: string) => Promise<unknown>
+  threads: () => number
+  cacheStats: () => unknown
+  setCacheCapacity: (bytes: number) => void
+  clearCache: () => void
+}
+
+interface NativeSolveRequest {
+  a_foguetes: number[]
+  epsolon: number
+  max_iter: number
+  trace: boolean
+  funcao: string
+}
+
+const loadNativeAddon = (): { addon: NativeAddon | null; error: string } => {
+  const file = app.isPackaged
+    ? path.join(process.resourcesPath, 'rootfinders_native.node')
+    : path.join(process.env.APP_ROOT!, 'RootFinders', 'rootfinders_native.node')
+  try {
+    return { addon: createRequire(import.meta.url)(file) as NativeAddon, error: '' }
+  } catch (error) {
+    return { addon: null, error: error instanceof Error ? error.message : String(error) }
+  }
+}
+
+const native = loadNativeAddon()
+
+ipcMain.handle('native-solver-info', () => ({
+  available: native.addon !== null,
+  threads: native.addon?.threads() ?? 0,
+  error: native.error,
+}))
+
+// Mesmos argumentos de comparative_boards_numeric. Erros do cálculo (expressão inválida, ...) voltam em { error },
+// com a mensagem intacta; a Promise só é rejeitada se o addon não estiver disponível
+ipcMain.handle('comparative-boards', async (_event, request: NativeSolveRequest) => {
+  if (!native.addon) {
+    throw new Error('Addon nativo indisponível: ' + native.error)
+  }
+  try {
+    const boards = await native.addon.comparativeBoards(
+      Float64Array.from(request.a_foguetes), request.epsolon, request.max_iter, request.trace, request.funcao
+    )
+    return { boards }
+  } catch (error) {
+    return { error: error instanceof Error ? error.message : String(error) }
+  }
+})
+
+// Estatísticas do cache de resultados do addon, como as de um worker (src/solverWorker.ts): capacity troca o limite
+// antes da leitura e clear esvazia o cache depois
+ipcMain.handle('native-cache-stats', (_event, options: { capacity?: number; clear?: boolean }) => {
+  if (!native.addon) {
+    throw new Error('Addon nativo indisponível: ' + native.error)
+  }
+  if (options.capacity !== undefined) {
+    native.addon.setCacheCapacity(options.capacity)
+  }
+  const stats = native.addon.cacheStats()
+  if (options.clear) {
+    native.addon.clearCache()
+  }
+  return stats
+})
+
+// Abre um arquivo de resultados (.rfc) escrito pelo terminal (--binario ou --lote --formato binario) e devolve os
+// bytes ao renderer, que lê as colunas com readResultFile (src/resultFile.ts)
+ipcMain.handle('open-result-file', async () => {
+  const { canceled, filePaths } = await dialog.showOpenDialog({
+    properties: ['openFile'],
+    filters: [{ name: 'Resultados', extensions: ['rfc'] }],
+  })
+  if (canceled || filePaths.length === 0) {
+    return null
+  }
+  return readFile(filePaths[0])
+})
+
 app.whenReady().then(createWindow)
 
 app.on('window-all-closed', () => {
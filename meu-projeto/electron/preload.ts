@@ -15,5 +15,13 @@ contextBridge.exposeInMainWorld('electron', {
     if (validChannels.includes(channel)) {
       ipcRenderer.on(channel, (event, ...args) => func(...args))
     }
-  }
+  },
+  // Bytes de um arquivo de resultados escolhido pelo usuário (null se cancelado)
+  openResultFile: (): Promise<Uint8Array | null> => ipcRenderer.invoke('open-result-file'),
+  // Addon nativo dos métodos, rodando no processo principal (ver src/nativeSolver.ts)
+  nativeSolver: {
+    info: () => ipcRenderer.invoke('native-solver-info'),
+    comparativeBoards: (request: unknown) => ipcRenderer.invoke('comparative-boards', request),
+    cacheStats: (options: unknown) => ipcRenderer.invoke('native-cache-stats', options),
+  },
 })
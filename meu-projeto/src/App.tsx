@@ -1,4 +1,4 @@
-import React, { useState } from 'react';
+import React, { useEffect, useRef, useState } from 'react';
 import './App.css';
 import RocketListTitle from './components/RocketListTitle';
 import AddRocket from './components/AddRocket';
@@ -7,11 +7,16 @@ import EpsolonBox from './components/EpsolonBox';
 import TitleBox from './components/TitleBox';
 import ComparationFrameBoxList from './components/ComparationFrameBoxList';
 import MaxIterBox from './components/MaxIterBox';
-import Module from '../RootFinders/main.js'
+import FunctionBox from './components/FunctionBox';
 import ConvergenceChart from './components/ConvergenceChart.js';
 import FalsePositionIterationsChart from './components/FalsePositionIterationsChart.js';
 import BisectionIterationsChart from './components/BisectionIterationsChart.js';
 import NewtonRaphsonIterationsChart from './components/NewtonRaphsonIterationsChart.js';
+import BrentIterationsChart from './components/BrentIterationsChart.js';
+import IterationTraceChart from './components/IterationTraceChart.js';
+import { methodResult, type MethodResult, type NumericBoards } from './numericBoards';
+import { SolverRunner } from './solverRunner';
+import { CUSTOM_FUNCTION_UNAVAILABLE } from './legacyBoards';
 
 export type ComparationFrame = (string | number)[][];
 
@@ -30,54 +35,46 @@ const toScientificNotationLatex = (num: number): string => {
   return `\\(${mantissa} \\times 10^{${exp}}\\)`;
 };
 
-// Função para processar strings que contêm números e converter para LaTeX
-const formatNumbersInStringLatex = (str: string): string => {
-  // Detecta padrão x_N = valor (onde N é um número subscrito)
-  const subscriptPattern = /x_(\d+)\s*=\s*([-]?\d+\.?\d*(?:[eE][+-]?\d+)?)/g;
-  
-  // Primeiro, processa o padrão x_N = valor
-  let result = str.replace(subscriptPattern, (match, subscript, value) => {
-    const num = parseFloat(value);
-    if (!isNaN(num)) {
-      const latexValue = toScientificNotationLatex(num);
-      // Remove os delimitadores \( \) do valor convertido
-      const cleanLatexValue = latexValue.replace(/^\\\(/, '').replace(/\\\)$/, '');
-      return `\\(x_{${subscript}} = ${cleanLatexValue}\\)`;
-    }
-    return match;
-  });
-  
-  // Depois, processa números restantes que não fazem parte de x_N
-  // Evita converter números que estão após x_
-  const numberRegex = /(?<!x_)(-?\d+\.?\d*(?:[eE][+-]?\d+)?)/g;
-  
-  result = result.replace(numberRegex, (match) => {
-    // Verifica se já está dentro de um bloco LaTeX
-    const beforeMatch = result.substring(0, result.indexOf(match));
-    const openParens = (beforeMatch.match(/\\\(/g) || []).length;
-    const closeParens = (beforeMatch.match(/\\\)/g) || []).length;
-    
-    // Se está dentro de um bloco LaTeX, não converte novamente
-    if (openParens > closeParens) {
-      return match;
-    }
-    
-    const num = parseFloat(match);
-    if (!isNaN(num)) {
-      return toScientificNotationLatex(num);
-    }
-    return match;
-  });
-  
-  return result;
+// Remove os delimitadores \( \) de uma expressão LaTeX
+const stripLatexDelimiters = (latex: string): string =>
+  latex.replace(/^\\\(/, '').replace(/\\\)$/, '');
+
+// Monta os quadros exibidos a partir dos resultados numéricos (a partir do quadro start), formatando os números
+// apenas para exibição
+const framesFromNumeric = (boards: NumericBoards, a_foguetes: number[], start = 0): ComparationFrame[] => {
+  const frames: ComparationFrame[] = [];
+  for (let i = start; i < boards.count; i++) {
+    const results = boards.methods.map((_, m) => methodResult(boards, i, m));
+    const column = (label: string, cell: (r: MethodResult) => string | number) =>
+      [label, ...results.map(cell)];
+
+    frames.push([
+      [`a = ${a_foguetes[i].toFixed(6)}`, ...boards.methods],
+      column('Dados Iniciais', r => isNaN(r.initial[1])
+        ? `\\(x_{0} = ${stripLatexDelimiters(toScientificNotationLatex(r.initial[0]))}\\)`
+        : `[${toScientificNotationLatex(r.initial[0])},${toScientificNotationLatex(r.initial[1])}]`),
+      column('x', r => toScientificNotationLatex(r.root)),
+      column('f(x)', r => toScientificNotationLatex(r.residual)),
+      column('Erro', r => toScientificNotationLatex(r.error)),
+      column('Convergiu', r => r.converged ? 'Sim' : 'Não'),
+      column('Numero de Interações', r => r.iterations),
+    ]);
+  }
+  return frames;
 };
 
 function App() {
   const [a_foguetes, setAFoguetes] = useState<number[]>([]);
   const [epsolon, setEpsolon] = useState(0.0001);
   const [max_iter, setMaxIter] = useState(100);
+  const [funcao, setFuncao] = useState('');
   const [comparationFrameList, setComparationFrameList] = useState<ComparationFrame[]>([]);
+  const [numericBoards, setNumericBoards] = useState<NumericBoards | null>(null);
   const [isLoading, setIsLoading] = useState(false);
+  const [progress, setProgress] = useState(0);
+  const runnerRef = useRef<SolverRunner | null>(null);
+
+  useEffect(() => () => runnerRef.current?.dispose(), []);
 
   const addRocket = (value: number) => {
     setAFoguetes(prev => [...prev, value]);
@@ -94,86 +91,40 @@ function App() {
     }
 
     setIsLoading(true);
+    setProgress(0);
+    setNumericBoards(null);
+    setComparationFrameList([]);
     try {
-      // Carrega o módulo WebAssembly
-      const wasmModule = await Module();
-
-      // Cria um vetor de doubles para passar ao C++
-      const vectorDouble = new wasmModule.VectorDouble();
-      a_foguetes.forEach(value => vectorDouble.push_back(value));
-
-      // Chama a função comparative_boards do C++
-      const boards = wasmModule.comparative_boards(vectorDouble, epsolon, max_iter);
-
-      // Converte o resultado 3D em ComparationFrame[]
-      const newFrames: ComparationFrame[] = [];
-      for (let i = 0; i < boards.size(); i++) {
-        const board = boards.get(i);
-        const frame: ComparationFrame = [];
-
-        const numCols = board.size(); // 4 colunas (texto + 3 métodos)
-        const numRows = board.get(0).size(); // 6 linhas
-
-        for (let row = 0; row < numRows; row++) {
-          const frameRow: (string | number)[] = [];
-          for (let col = 0; col < numCols; col++) {
-            const column = board.get(col);
-            const value = column.get(row);
-
-            // Linha 0 (headers) - mantém como está
-            if (row === 0) {
-              frameRow.push(value);
-              continue;
-            }
-
-            // Coluna 0 (labels das linhas) - mantém como está
-            if (col === 0) {
-              frameRow.push(value);
-              continue;
-            }
-
-            // Linha 1 (intervalo ou x0) - processa strings com números em LaTeX
-            if (row === 1) {
-              frameRow.push(formatNumbersInStringLatex(value));
-              continue;
-            }
-
-            // Linhas 2-6 e colunas 1+ - valores numéricos em LaTeX
-            if(row <= 5){
-
-              const numValue = parseFloat(value);
-              if (!isNaN(numValue)) {
-              frameRow.push(toScientificNotationLatex(numValue));
-              } else {
-              // Se não for número, tenta processar como string com números
-                frameRow.push(formatNumbersInStringLatex(value));
-              }
-            }
-
-            if(row == 6){
-              frameRow.push(value)
-            }
-
-          }
-          frame.push(frameRow);
+      // Os quadros são resolvidos fora da thread da interface sempre que possível e chegam aos poucos, em ordem
+      runnerRef.current ??= new SolverRunner();
+      const rockets = [...a_foguetes];
+      await runnerRef.current.run(
+        { a_foguetes: rockets, epsolon, max_iter, trace: true, funcao },
+        {
+          onBoards: boards => {
+            setNumericBoards(boards);
+            // Os quadros já montados não mudam: só os novos são formatados
+            setComparationFrameList(prev =>
+              [...prev.slice(0, boards.count), ...framesFromNumeric(boards, rockets, prev.length)]);
+          },
+          onProgress: (done, total) => setProgress(done / total),
         }
-
-        newFrames.push(frame);
-      }
-
-      setComparationFrameList(newFrames);
-
-      // Limpa os vetores do C++
-      vectorDouble.delete();
-      boards.delete();
+      );
     } catch (error) {
       console.error('Erro ao executar WebAssembly:', error);
-      alert('Erro ao processar os dados. Verifique o console.');
+      const message = error instanceof Error ? error.message : '';
+      alert(message.startsWith('Expressão inválida') || message === CUSTOM_FUNCTION_UNAVAILABLE
+        ? message
+        : 'Erro ao processar os dados. Verifique o console.');
     } finally {
       setIsLoading(false);
     }
   };
 
+  const handleCancel = () => {
+    runnerRef.current?.cancel();
+  };
+
   const StartButton = () => {
     return (
           <button  
@@ -181,7 +132,18 @@ function App() {
             onClick={handleStart}
             disabled={isLoading || a_foguetes.length === 0}
           >
-            {isLoading ? 'Processando...' : 'Start'}
+            {isLoading ? `Processando... ${Math.floor(progress * 100)}%` : 'Start'}
+          </button>
+    )
+  }
+
+  const CancelButton = () => {
+    return (
+          <button
+            className="start-button"
+            onClick={handleCancel}
+          >
+            Cancelar
           </button>
     )
   }
@@ -203,8 +165,10 @@ function App() {
           {/* Linha superior com controles horizontais */}
           <div className="top-controls">
             <StartButton/>
+            {isLoading && <CancelButton/>}
             <EpsolonBox value={epsolon} onChange={setEpsolon} />
             <MaxIterBox value={max_iter} onChange={setMaxIter} />
+            <FunctionBox value={funcao} onChange={setFuncao} />
             <TitleBox />
           </div>
 
@@ -216,10 +180,12 @@ function App() {
 
         </div>
             <div className= "graphs-section">
-          <ConvergenceChart a_foguetes={a_foguetes} comparationFrameList={comparationFrameList}/>      
-          <FalsePositionIterationsChart a_foguetes={a_foguetes} comparationFrameList={comparationFrameList} />
-          <BisectionIterationsChart a_foguetes={a_foguetes} comparationFrameList={comparationFrameList} />
-          <NewtonRaphsonIterationsChart a_foguetes={a_foguetes} comparationFrameList={comparationFrameList} />
+          <ConvergenceChart a_foguetes={a_foguetes} boards={numericBoards}/>      
+          <FalsePositionIterationsChart a_foguetes={a_foguetes} boards={numericBoards} />
+          <BisectionIterationsChart a_foguetes={a_foguetes} boards={numericBoards} />
+          <NewtonRaphsonIterationsChart a_foguetes={a_foguetes} boards={numericBoards} />
+          <BrentIterationsChart a_foguetes={a_foguetes} boards={numericBoards} />
+          <IterationTraceChart a_foguetes={a_foguetes} boards={numericBoards} />
           </div>
         </div>
 
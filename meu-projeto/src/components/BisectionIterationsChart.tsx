@@ -10,11 +10,11 @@ import {
   ResponsiveContainer,
   TooltipProps
 } from 'recharts';
-import { ComparationFrame } from '../App';
+import { methodResult, type NumericBoards } from '../numericBoards';
 
 interface BisectionIterationsChartProps {
   a_foguetes: number[];
-  comparationFrameList: ComparationFrame[];
+  boards: NumericBoards | null;
 }
 
 interface DataPoint {
@@ -25,51 +25,25 @@ interface DataPoint {
 
 const BisectionIterationsChart: React.FC<BisectionIterationsChartProps> = ({
   a_foguetes,
-  comparationFrameList
+  boards
 }) => {
-  const extractIterationsData = (frame: ComparationFrame, methodColumn: number) => {
-    const iterationsRow = frame[6];
-    const convergenceRow = frame[5];
-    const iterationsValue = iterationsRow[methodColumn];
-    const convergenceStatus = convergenceRow[methodColumn];
-
-    let iterations: number;
-    if (typeof iterationsValue === 'string') {
-      let cleanValue = iterationsValue.trim().replace(/^\\\(/, '').replace(/\\\)$/, '');
-      iterations = parseInt(cleanValue, 10);
-    } else {
-      iterations = Number(iterationsValue);
-    }
-
-    const hasConverged = typeof convergenceStatus === 'string' &&
-      convergenceStatus.toLowerCase().includes('sim');
-
-    return { iterations, hasConverged };
-  };
-
   const processData = () => {
     const convergedData: DataPoint[] = [];
     const notConvergedData: DataPoint[] = [];
-    const methodColumn = 1; // Bissecção
+    const method = 0; // Bissecção
+
+    if (!boards) {
+      return { convergedData, notConvergedData };
+    }
 
-    for (let i = 0; i < a_foguetes.length && i < comparationFrameList.length; i++) {
-      const a = a_foguetes[i];
-      const frame = comparationFrameList[i];
+    for (let i = 0; i < a_foguetes.length && i < boards.count; i++) {
+      const { iterations, converged } = methodResult(boards, i, method);
+      const dataPoint: DataPoint = { a: a_foguetes[i], iterations, converged };
 
-      try {
-        const { iterations, hasConverged } = extractIterationsData(frame, methodColumn);
-        
-        if (!isNaN(iterations) && isFinite(iterations)) {
-          const dataPoint: DataPoint = { a, iterations, converged: hasConverged };
-          
-          if (hasConverged) {
-            convergedData.push(dataPoint);
-          } else {
-            notConvergedData.push(dataPoint);
-          }
-        }
-      } catch (error) {
-        console.error(`Erro ao processar dados para a=${a}:`, error);
+      if (converged) {
+        convergedData.push(dataPoint);
+      } else {
+        notConvergedData.push(dataPoint);
       }
     }
 
@@ -10,11 +10,11 @@ import {
   ResponsiveContainer,
   TooltipProps
 } from 'recharts';
-import type { ComparationFrame } from '../App';
+import { methodResult, type NumericBoards } from '../numericBoards';
 
 interface ConvergenceChartProps {
   a_foguetes: number[];
-  comparationFrameList: ComparationFrame[];
+  boards: NumericBoards | null;
 }
 
 interface DataPoint {
@@ -25,49 +25,16 @@ interface DataPoint {
 
 const ConvergenceChart: React.FC<ConvergenceChartProps> = ({
   a_foguetes,
-  comparationFrameList
+  boards
 }) => {
-  const extractConvergenceData = (frame: ComparationFrame) => {
-    const xRow = frame[2];
-    const convergenceRow = frame[5];
+  // Raízes dos métodos que convergiram no quadro i
+  const extractConvergenceData = (data: NumericBoards, board: number) => {
     const convergedValues: number[] = [];
 
-    for (let col = 1; col < xRow.length; col++) {
-      const convergenceStatus = convergenceRow[col];
-      const hasConverged = typeof convergenceStatus === 'string' &&
-        convergenceStatus.toLowerCase().includes('sim');
-
-      if (hasConverged) {
-        const xValue = xRow[col];
-        let numValue: number;
-
-        if (typeof xValue === 'string') {
-          let cleanValue = xValue.trim();
-          cleanValue = cleanValue.replace(/^\\\(/, '').replace(/\\\)$/, '');
-
-          const scientificRegex = /([-+]?\d+\.?\d*)\s*\\times\s*10\^?\{?([-+]?\d+)\}?/;
-          const match = cleanValue.match(scientificRegex);
-
-          if (match) {
-            const mantissa = parseFloat(match[1]);
-            const exponent = parseInt(match[2], 10);
-            numValue = mantissa * Math.pow(10, exponent);
-          } else {
-            cleanValue = cleanValue
-              .replace(/[×x]\s*10\^?\{?([-+]?\d+)\}?/gi, 'e$1')
-              .replace(/\\/g, '')
-              .trim();
-            numValue = parseFloat(cleanValue);
-          }
-        } else if (typeof xValue === 'number') {
-          numValue = xValue;
-        } else {
-          numValue = Number(xValue);
-        }
-
-        if (!isNaN(numValue) && isFinite(numValue)) {
-          convergedValues.push(numValue);
-        }
+    for (let method = 0; method < data.methods.length; method++) {
+      const { root, converged } = methodResult(data, board, method);
+      if (converged && isFinite(root)) {
+        convergedValues.push(root);
       }
     }
 
@@ -78,10 +45,13 @@ const ConvergenceChart: React.FC<ConvergenceChartProps> = ({
     const convergedData: DataPoint[] = [];
     const notConvergedData: DataPoint[] = [];
 
-    for (let i = 0; i < a_foguetes.length && i < comparationFrameList.length; i++) {
+    if (!boards) {
+      return { convergedData, notConvergedData };
+    }
+
+    for (let i = 0; i < a_foguetes.length && i < boards.count; i++) {
       const a = a_foguetes[i];
-      const frame = comparationFrameList[i];
-      const convergedValues = extractConvergenceData(frame);
+      const convergedValues = extractConvergenceData(boards, i);
 
       if (convergedValues.length > 0) {
         const average = convergedValues.reduce((sum, val) => sum + val, 0) / convergedValues.length;
@@ -0,0 +1,24 @@
+import React from 'react';
+
+interface FunctionBoxProps {
+  value: string;
+  onChange: (value: string) => void;
+}
+
+// Expressão de f(d) resolvida pelos métodos, nas variáveis a (valor de cada foguete) e d. Vazia = a*d - d*log(d)
+const FunctionBox: React.FC<FunctionBoxProps> = ({ value, onChange }) => {
+  return (
+    <div className="function-box">
+      <label>Função f(d):</label>
+      <input
+        type="text"
+        value={value}
+        placeholder="a*d - d*log(d)"
+        spellCheck={false}
+        onChange={(e) => onChange(e.target.value)}
+      />
+    </div>
+  );
+};
+
+export default FunctionBox;
@@ -0,0 +1,106 @@
+import React, { useState } from 'react';
+import {
+  LineChart,
+  Line,
+  XAxis,
+  YAxis,
+  CartesianGrid,
+  Tooltip,
+  Legend,
+  ResponsiveContainer
+} from 'recharts';
+import { methodTrace, type NumericBoards } from '../numericBoards';
+
+interface IterationTraceChartProps {
+  a_foguetes: number[];
+  boards: NumericBoards | null;
+}
+
+// Uma linha por iteração, com |f(x)| de cada método (undefined quando o método já terminou)
+type DataPoint = { k: number } & Record<string, number | undefined>;
+
+const COLORS = ['#2563eb', '#16a34a', '#dc2626', '#9333ea', '#ea580c'];
+
+const IterationTraceChart: React.FC<IterationTraceChartProps> = ({
+  a_foguetes,
+  boards
+}) => {
+  const [selected, setSelected] = useState(0);
+
+  if (!boards || boards.count === 0 || boards.trace.length === 0) {
+    return null;
+  }
+
+  const board = Math.min(selected, boards.count - 1);
+
+  const processData = () => {
+    const rows = new Map<number, DataPoint>();
+    boards.methods.forEach((method, m) => {
+      for (const point of methodTrace(boards, board, m)) {
+        const row = rows.get(point.k) ?? { k: point.k };
+        // Escala logarítmica não aceita zero: usa o menor double positivo no lugar
+        row[method] = Math.max(Math.abs(point.fx), Number.MIN_VALUE);
+        rows.set(point.k, row);
+      }
+    });
+    return [...rows.values()].sort((p, q) => p.k - q.k);
+  };
+
+  const data = processData();
+
+  return (
+    <div style={{ width: '800px', height: '500px' }}>
+      <h3 style={{ textAlign: 'center', marginBottom: '10px' }}>
+        Convergência por iteração
+      </h3>
+      <div style={{ textAlign: 'center', marginBottom: '10px' }}>
+        <select value={board} onChange={e => setSelected(Number(e.target.value))}>
+          {Array.from({ length: boards.count }, (_, i) => (
+            <option key={i} value={i}>
+              Foguete {i + 1} (a = {a_foguetes[i]})
+            </option>
+          ))}
+        </select>
+      </div>
+      <ResponsiveContainer width="100%" height="100%">
+        <LineChart
+          data={data}
+          margin={{ top: 20, right: 30, bottom: 60, left: 60 }}
+        >
+          <CartesianGrid strokeDasharray="3 3" />
+          <XAxis
+            type="number"
+            dataKey="k"
+            name="Iteração"
+            label={{ value: 'Iteração', position: 'insideBottom', offset: -10 }}
+          />
+          <YAxis
+            type="number"
+            scale="log"
+            domain={['auto', 'auto']}
+            allowDataOverflow
+            label={{ value: '|f(x)|', angle: -90, position: 'insideLeft' }}
+          />
+          <Tooltip formatter={(value: number) => value.toExponential(4)} />
+          <Legend
+            verticalAlign="top"
+            height={36}
+            wrapperStyle={{ paddingBottom: '20px' }}
+          />
+          {boards.methods.map((method, m) => (
+            <Line
+              key={method}
+              type="monotone"
+              dataKey={method}
+              stroke={COLORS[m % COLORS.length]}
+              dot={false}
+              connectNulls
+            />
+          ))}
+        </LineChart>
+      </ResponsiveContainer>
+    </div>
+  );
+};
+
+export default IterationTraceChart;
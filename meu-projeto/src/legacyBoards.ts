@@ -0,0 +1,87 @@
+import type { NumericBoards } from './numericBoards';
+
+/*
+Compatibilidade com módulos WASM (RootFinders/main.js e main.wasm) compilados antes de comparative_boards_numeric.
+Esses módulos só exportam comparative_boards, que devolve os quadros como strings, e foram compilados com
+-sENVIRONMENT=web, então não carregam dentro de Web Workers. Enquanto os artefatos versionados não forem
+regenerados (emcmake cmake -S . -B build-wasm && cmake --build build-wasm --target wasm, em RootFinders/), o
+SolverRunner usa este caminho na thread da interface.
+*/
+
+// O módulo tem a versão numérica dos quadros (e, por ter sido compilado pelo alvo wasm do CMake, roda em workers)
+export const hasNumericBoards = (wasmModule: any): boolean =>
+  typeof wasmModule.comparative_boards_numeric === 'function';
+
+export const CUSTOM_FUNCTION_UNAVAILABLE =
+  'Função personalizada indisponível: o módulo WebAssembly carregado é anterior a set_function e só resolve ' +
+  'a*d - d*log(d). Recompile main.js/main.wasm pelo alvo wasm do CMake.';
+
+// Compila funcao no módulo com set_function (vazia = a*d - d*log(d)). Sem set_function, só a função padrão é aceita
+export const applyFunction = (wasmModule: any, funcao: string) => {
+  if (typeof wasmModule.set_function !== 'function') {
+    if (funcao.trim()) {
+      throw new Error(CUSTOM_FUNCTION_UNAVAILABLE);
+    }
+    return;
+  }
+  const compileError: string = wasmModule.set_function(funcao);
+  if (compileError) {
+    throw new Error(compileError);
+  }
+};
+
+// "[A,B]" (métodos de barramento) ou "x_0 = v" (Newton-Raphson)
+const parseInitial = (text: string): [number, number] => {
+  const bracket = /^\[(.*),(.*)\]$/.exec(text);
+  if (bracket) {
+    return [parseFloat(bracket[1]), parseFloat(bracket[2])];
+  }
+  return [parseFloat(text.replace(/^x_0 = /, '')), NaN];
+};
+
+// Resolve os quadros com comparative_boards e converte as strings para o formato numérico. Avaliações de f e o
+// histórico das iterações não existem nesse formato: evaluations fica 0 e o histórico vazio
+export const legacyNumericBoards = (
+  wasmModule: any, a_foguetes: number[], epsolon: number, max_iter: number
+): NumericBoards => {
+  const vectorDouble = new wasmModule.VectorDouble();
+  a_foguetes.forEach(value => vectorDouble.push_back(value));
+  const raw = wasmModule.comparative_boards(vectorDouble, epsolon, max_iter);
+  vectorDouble.delete();
+
+  // Um quadro é uma lista de colunas: textos e depois um método por coluna (nome, dados iniciais, x, f(x), erro,
+  // convergiu, interações)
+  const count = raw.size();
+  const methods: string[] = [];
+  if (count > 0) {
+    const board = raw.get(0);
+    for (let col = 1; col < board.size(); col++) {
+      const column = board.get(col);
+      methods.push(column.get(0));
+      column.delete();
+    }
+    board.delete();
+  }
+
+  const doubleStride = 5;
+  const intStride = 5;
+  const doubles = new Float64Array(count * methods.length * doubleStride);
+  const ints = new Int32Array(count * methods.length * intStride);
+  for (let i = 0; i < count; i++) {
+    const board = raw.get(i);
+    for (let m = 0; m < methods.length; m++) {
+      const column = board.get(m + 1);
+      const slot = i * methods.length + m;
+      const [initialA, initialB] = parseInitial(column.get(1));
+      doubles.set([initialA, initialB, parseFloat(column.get(2)), parseFloat(column.get(3)), parseFloat(column.get(4))],
+        slot * doubleStride);
+      ints[slot * intStride] = column.get(5) === 'Sim' ? 1 : 0;
+      ints[slot * intStride + 1] = parseInt(column.get(6), 10);
+      column.delete();
+    }
+    board.delete();
+  }
+  raw.delete();
+
+  return { count, methods, doubleStride, intStride, traceStride: 4, doubles, ints, trace: new Float64Array(0) };
+};
@@ -0,0 +1,30 @@
+import type { NumericBoards } from './numericBoards';
+import type { CacheStats } from './solverMetrics';
+
+// Backend nativo dos métodos: o addon N-API (RootFinders/native_addon.cpp) carregado pelo processo principal do
+// Electron e exposto pelo preload. Fora do Electron, ou se o addon não carregou, o SolverRunner usa o módulo WASM
+export interface NativeSolveRequest {
+  a_foguetes: number[];
+  epsolon: number;
+  max_iter: number;
+  trace: boolean;
+  funcao: string; // Expressão em a e d (vazia = a*d - d*log(d))
+}
+
+export interface NativeSolverInfo {
+  available: boolean;
+  threads: number; // Threads usadas por chamada (núcleos da máquina)
+  error: string;   // Motivo de o addon não ter carregado
+}
+
+export interface NativeSolverApi {
+  info(): Promise<NativeSolverInfo>;
+  // Rejeitada só se o addon não estiver disponível; erros do cálculo vêm em { error }
+  comparativeBoards(request: NativeSolveRequest): Promise<{ boards: NumericBoards } | { error: string }>;
+  // Cache de resultados do addon (um só, compartilhado pelas threads): capacity troca o limite de bytes antes da
+  // leitura e clear esvazia o cache depois
+  cacheStats(options: { capacity?: number; clear?: boolean }): Promise<CacheStats>;
+}
+
+export const nativeSolverApi = (): NativeSolverApi | null =>
+  (globalThis as unknown as { electron?: { nativeSolver?: NativeSolverApi } }).electron?.nativeSolver ?? null;
@@ -0,0 +1,135 @@
+// Resultados numéricos retornados por comparative_boards_numeric (ver quadro_comparativo_numerico em main.cpp)
+export interface NumericBoards {
+  count: number;          // Número de quadros (um por valor de a)
+  methods: string[];      // Nome de cada método, na ordem das colunas
+  doubleStride: number;   // Doubles por (quadro, método): A (ou x0), B, x, |f(x)|, erro
+  intStride: number;      // Inteiros por (quadro, método): convergiu, interações, avaliações de f, início e tamanho do histórico
+  traceStride: number;    // Doubles por registro do histórico: k, x, f(x), largura do intervalo ou passo
+  doubles: Float64Array;
+  ints: Int32Array;
+  trace: Float64Array;    // Histórico das iterações (vazio se não foi pedido)
+}
+
+export interface MethodResult {
+  initial: [number, number];
+  root: number;
+  residual: number;
+  error: number;
+  converged: boolean;
+  iterations: number;
+  evaluations: number;
+}
+
+// Copia as views (que apontam para a memória do WASM) para arrays próprios do JS
+export const copyNumericBoards = (raw: NumericBoards): NumericBoards => ({
+  count: raw.count,
+  methods: [...raw.methods],
+  doubleStride: raw.doubleStride,
+  intStride: raw.intStride,
+  traceStride: raw.traceStride,
+  doubles: raw.doubles.slice(),
+  ints: raw.ints.slice(),
+  trace: raw.trace.slice(),
+});
+
+export const methodResult = (boards: NumericBoards, board: number, method: number): MethodResult => {
+  const slot = board * boards.methods.length + method;
+  const d = slot * boards.doubleStride;
+  const n = slot * boards.intStride;
+  return {
+    initial: [boards.doubles[d], boards.doubles[d + 1]],
+    root: boards.doubles[d + 2],
+    residual: boards.doubles[d + 3],
+    error: boards.doubles[d + 4],
+    converged: boards.ints[n] !== 0,
+    iterations: boards.ints[n + 1],
+    evaluations: boards.ints[n + 2],
+  };
+};
+
+export interface TracePoint {
+  k: number;
+  x: number;
+  fx: number;
+  width: number;
+}
+
+// Histórico das iterações de um método em um quadro
+export const methodTrace = (boards: NumericBoards, board: number, method: number): TracePoint[] => {
+  const n = (board * boards.methods.length + method) * boards.intStride;
+  const start = boards.ints[n + 3];
+  const length = boards.ints[n + 4];
+  const points: TracePoint[] = [];
+  for (let r = start; r < start + length; r++) {
+    const t = r * boards.traceStride;
+    points.push({ k: boards.trace[t], x: boards.trace[t + 1], fx: boards.trace[t + 2], width: boards.trace[t + 3] });
+  }
+  return points;
+};
+
+/*
+Junta os blocos de quadros de uma execução, na ordem, sem copiar de novo o que já chegou: doubles e ints são
+alocados uma vez para o total de quadros (conhecido de antemão) e o histórico, cujo tamanho só se sabe no fim, cresce
+dobrando de capacidade. boards() devolve views (subarray) do prefixo já preenchido.
+*/
+export class NumericBoardsBuilder {
+  private readonly total: number;
+  private layout: NumericBoards | null = null;
+  private count = 0;
+  private traceLength = 0;
+
+  constructor(total: number) {
+    this.total = total;
+  }
+
+  append(chunk: NumericBoards) {
+    if (!this.layout) {
+      const slots = this.total * chunk.methods.length;
+      this.layout = {
+        ...chunk,
+        count: 0,
+        doubles: new Float64Array(slots * chunk.doubleStride),
+        ints: new Int32Array(slots * chunk.intStride),
+        trace: new Float64Array(Math.max(chunk.trace.length, 1024)),
+      };
+    }
+    const layout = this.layout;
+    const doubleStart = this.count * layout.methods.length * layout.doubleStride;
+    const intStart = this.count * layout.methods.length * layout.intStride;
+    layout.doubles.set(chunk.doubles, doubleStart);
+    layout.ints.set(chunk.ints, intStart);
+
+    // Os índices do histórico do bloco passam a contar a partir do fim do histórico já acumulado
+    const traceOffset = this.traceLength / layout.traceStride;
+    for (let n = intStart; n < intStart + chunk.ints.length; n += layout.intStride) {
+      layout.ints[n + 3] += traceOffset;
+    }
+    if (this.traceLength + chunk.trace.length > layout.trace.length) {
+      const trace = new Float64Array(Math.max(2 * layout.trace.length, this.traceLength + chunk.trace.length));
+      trace.set(layout.trace.subarray(0, this.traceLength));
+      layout.trace = trace;
+    }
+    layout.trace.set(chunk.trace, this.traceLength);
+    this.traceLength += chunk.trace.length;
+    this.count += chunk.count;
+  }
+
+  get size() {
+    return this.count;
+  }
+
+  boards(): NumericBoards | null {
+    if (!this.layout) {
+      return null;
+    }
+    const layout = this.layout;
+    const slots = this.count * layout.methods.length;
+    return {
+      ...layout,
+      count: this.count,
+      doubles: layout.doubles.subarray(0, slots * layout.doubleStride),
+      ints: layout.ints.subarray(0, slots * layout.intStride),
+      trace: layout.trace.subarray(0, this.traceLength),
+    };
+  }
+}
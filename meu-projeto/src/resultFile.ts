@@ -0,0 +1,58 @@
+// Leitura do arquivo binário colunar de resultados (.rfc) escrito por ResultFileWriter (ver RootFinders/result_file.hpp).
+// As colunas são views sobre o próprio buffer, sem cópia nem conversão; o buffer deve começar no início do arquivo
+// (para um Uint8Array vindo do IPC, use bytes.buffer.slice(bytes.byteOffset, bytes.byteOffset + bytes.byteLength)).
+export interface ResultFile {
+  count: number;                   // Número de linhas (pares valor de a, método)
+  methods: string[];               // Nome de cada método; a coluna method guarda o índice nesse vetor
+  a: Float64Array;
+  root: Float64Array;
+  residual: Float64Array;
+  error: Float64Array;
+  iterations: Int32Array;
+  evaluations: Int32Array;
+  method: Uint8Array;
+  converged: Uint8Array;
+}
+
+const MAGIC = 'RFCOLS';
+const VERSION = 1;
+const HEADER_SIZE = 512;
+const COLUMNS = 8;
+const NAME_SIZE = 24;
+
+export const readResultFile = (buffer: ArrayBuffer): ResultFile => {
+  if (buffer.byteLength < HEADER_SIZE) {
+    throw new Error('Arquivo de resultados inválido');
+  }
+  const header = new DataView(buffer, 0, HEADER_SIZE);
+  const bytes = new Uint8Array(buffer, 0, HEADER_SIZE);
+  const magic = String.fromCharCode(...bytes.subarray(0, MAGIC.length));
+  if (magic !== MAGIC || header.getUint32(8, true) !== VERSION) {
+    throw new Error('Arquivo de resultados inválido (versão ' + VERSION + ')');
+  }
+
+  const nMethods = header.getUint32(12, true);
+  const count = Number(header.getBigUint64(16, true));
+  const offset = (c: number) => Number(header.getBigUint64(24 + 8 * c, true));
+  const decoder = new TextDecoder();
+  const methods: string[] = [];
+  for (let m = 0; m < nMethods; m++) {
+    const name = bytes.subarray(24 + 8 * COLUMNS + m * NAME_SIZE, 24 + 8 * COLUMNS + (m + 1) * NAME_SIZE);
+    const end = name.indexOf(0);
+    methods.push(decoder.decode(end < 0 ? name : name.subarray(0, end)));
+  }
+
+  // Mesma ordem de ResultColumn
+  return {
+    count,
+    methods,
+    a: new Float64Array(buffer, offset(0), count),
+    root: new Float64Array(buffer, offset(1), count),
+    residual: new Float64Array(buffer, offset(2), count),
+    error: new Float64Array(buffer, offset(3), count),
+    iterations: new Int32Array(buffer, offset(4), count),
+    evaluations: new Int32Array(buffer, offset(5), count),
+    method: new Uint8Array(buffer, offset(6), count),
+    converged: new Uint8Array(buffer, offset(7), count),
+  };
+};
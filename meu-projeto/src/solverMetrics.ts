@@ -0,0 +1,105 @@
+// Contadores por método exportados pelo módulo WASM em metrics_json() (ver RootFinders/metrics.hpp). Só são
+// preenchidos quando o módulo é compilado com RF_METRICS (-DROOTFINDERS_METRICS=ON); caso contrário enabled = false
+export interface MethodMetrics {
+  solves: number;
+  converged: number;
+  not_converged: number;
+  invalid_brackets: number;
+  near_zero_divisions: number;
+  function_evaluations: number;
+  interations: number;
+  time_ns: { total: number; min: number; max: number; mean: number };
+  interations_histogram: number[]; // Faixa 0: 0 interações; faixa i: [2^(i-1), 2^i); a última acumula as maiores
+}
+
+export interface SolverMetrics {
+  enabled: boolean;
+  methods: Record<string, MethodMetrics>;
+}
+
+const mergeMethod = (a: MethodMetrics, b: MethodMetrics): MethodMetrics => {
+  const solves = a.solves + b.solves;
+  const total = a.time_ns.total + b.time_ns.total;
+  return {
+    solves,
+    converged: a.converged + b.converged,
+    not_converged: a.not_converged + b.not_converged,
+    invalid_brackets: a.invalid_brackets + b.invalid_brackets,
+    near_zero_divisions: a.near_zero_divisions + b.near_zero_divisions,
+    function_evaluations: a.function_evaluations + b.function_evaluations,
+    interations: a.interations + b.interations,
+    time_ns: {
+      total,
+      min: a.solves === 0 ? b.time_ns.min : b.solves === 0 ? a.time_ns.min : Math.min(a.time_ns.min, b.time_ns.min),
+      max: Math.max(a.time_ns.max, b.time_ns.max),
+      mean: solves ? Math.floor(total / solves) : 0,
+    },
+    interations_histogram: a.interations_histogram.map((count, i) => count + (b.interations_histogram[i] ?? 0)),
+  };
+};
+
+// Soma as métricas de várias instâncias do módulo (uma por Web Worker)
+export const mergeMetrics = (snapshots: SolverMetrics[]): SolverMetrics => {
+  const merged: SolverMetrics = { enabled: snapshots.some(s => s.enabled), methods: {} };
+  for (const snapshot of snapshots) {
+    for (const [name, metrics] of Object.entries(snapshot.methods)) {
+      merged.methods[name] = merged.methods[name] ? mergeMethod(merged.methods[name], metrics) : metrics;
+    }
+  }
+  return merged;
+};
+
+// Lê as métricas de uma instância do módulo e, se reset, zera os contadores. Módulos compilados antes de
+// metrics_json respondem como se as métricas estivessem desligadas
+export const readMetrics = (wasmModule: any, reset: boolean): SolverMetrics => {
+  if (typeof wasmModule.metrics_json !== 'function') {
+    return { enabled: false, methods: {} };
+  }
+  const metrics: SolverMetrics = JSON.parse(wasmModule.metrics_json());
+  if (reset) {
+    wasmModule.reset_metrics();
+  }
+  return metrics;
+};
+
+// Estatísticas do cache de resultados de uma instância do módulo WASM (cache_stats() em RootFinders/main.cpp)
+export interface CacheStats {
+  hits: number;
+  misses: number;
+  evictions: number;
+  entries: number;
+  bytes: number;    // Memória estimada das entradas
+  capacity: number; // Limite de bytes de cada instância
+}
+
+// Soma as estatísticas dos caches dos workers; capacity continua sendo o limite de cada um
+export const mergeCacheStats = (snapshots: CacheStats[]): CacheStats => snapshots.reduce(
+  (total, s) => ({
+    hits: total.hits + s.hits,
+    misses: total.misses + s.misses,
+    evictions: total.evictions + s.evictions,
+    entries: total.entries + s.entries,
+    bytes: total.bytes + s.bytes,
+    capacity: Math.max(total.capacity, s.capacity),
+  }),
+  { hits: 0, misses: 0, evictions: 0, entries: 0, bytes: 0, capacity: 0 }
+);
+
+// Lê as estatísticas do cache de uma instância do módulo, trocando antes o limite de bytes (capacity) e esvaziando o
+// cache depois da leitura (clear). Módulos compilados antes do cache respondem com tudo zerado
+export const readCacheStats = (wasmModule: any, options: { capacity?: number; clear?: boolean }): CacheStats => {
+  if (typeof wasmModule.cache_stats !== 'function') {
+    return { hits: 0, misses: 0, evictions: 0, entries: 0, bytes: 0, capacity: 0 };
+  }
+  if (options.capacity !== undefined) {
+    wasmModule.set_cache_capacity(options.capacity);
+  }
+  const stats: CacheStats = wasmModule.cache_stats();
+  if (options.clear) {
+    wasmModule.clear_cache();
+  }
+  return stats;
+};
+
+export const cacheHitRate = (stats: CacheStats) =>
+  stats.hits + stats.misses > 0 ? stats.hits / (stats.hits + stats.misses) : 0;
@@ -0,0 +1,369 @@
+import { NumericBoardsBuilder, type NumericBoards } from './numericBoards';
+import { applyFunction, hasNumericBoards, legacyNumericBoards } from './legacyBoards';
+import { nativeSolverApi, type NativeSolverApi } from './nativeSolver';
+import { mergeCacheStats, mergeMetrics, readCacheStats, readMetrics, type CacheStats, type SolverMetrics } from './solverMetrics';
+import type { CacheRequest, MetricsRequest, SolveRequest } from './solverWorker';
+
+export interface RunParams {
+  a_foguetes: number[];
+  epsolon: number;
+  max_iter: number;
+  trace: boolean;
+  funcao: string;
+}
+
+export interface RunCallbacks {
+  // Chamado com os quadros contíguos desde o início da lista, conforme chegam (no máximo a cada
+  // BOARDS_INTERVAL_MS, e sempre ao terminar)
+  onBoards: (boards: NumericBoards) => void;
+  onProgress: (done: number, total: number) => void;
+}
+
+export type RunStatus = 'done' | 'cancelled';
+
+// Intervalo mínimo entre duas entregas de quadros parciais: a cada entrega a interface remonta quadros e gráficos
+const BOARDS_INTERVAL_MS = 200;
+
+// Entrega os quadros acumulados em builder no máximo a cada BOARDS_INTERVAL_MS; flush() entrega o que faltar
+const throttledBoards = (builder: NumericBoardsBuilder, onBoards: RunCallbacks['onBoards']) => {
+  let last = -Infinity;
+  let delivered = 0;
+  let timer: ReturnType<typeof setTimeout> | null = null;
+  const deliver = () => {
+    timer = null;
+    last = performance.now();
+    delivered = builder.size;
+    const boards = builder.boards();
+    if (boards) {
+      onBoards(boards);
+    }
+  };
+  const cancel = () => {
+    if (timer !== null) {
+      clearTimeout(timer);
+      timer = null;
+    }
+  };
+  return {
+    update() {
+      if (timer === null) {
+        const wait = last + BOARDS_INTERVAL_MS - performance.now();
+        if (wait <= 0) {
+          deliver();
+        } else {
+          timer = setTimeout(deliver, wait);
+        }
+      }
+    },
+    flush() {
+      cancel();
+      if (builder.size > delivered) {
+        deliver();
+      }
+    },
+    cancel,
+  };
+};
+
+type WorkerMessage =
+  | { type: 'result'; runId: number; chunk: number; boards: NumericBoards }
+  | { type: 'error'; runId: number; chunk: number; message: string };
+
+/*
+Distribui a lista de foguetes, em blocos, entre alguns Web Workers (cada um com sua própria instância do módulo
+WASM), de modo que vários núcleos trabalham ao mesmo tempo e a interface nunca é bloqueada. O bloco i é sempre
+resolvido pelo worker i % workers.length, que recebe o próximo bloco seu assim que termina o anterior: como o cache de
+resultados é de cada worker, repetir a mesma lista leva cada valor de a ao worker que já o tem no cache. Os resultados
+são entregues em ordem, conforme os blocos iniciais ficam prontos, e cancel() interrompe a execução no fim dos blocos
+em andamento.
+
+No Electron, se o addon nativo estiver disponível (src/nativeSolver.ts), os blocos vão para ele em vez dos workers:
+blocos maiores, um de cada vez, cada um resolvido em todos os núcleos pelo processo principal. Se o addon não
+carregou ou falhar, a execução volta para os workers e o addon não é mais usado.
+
+Os workers precisam de um módulo WASM com comparative_boards_numeric (compilado pelo alvo wasm do CMake, que também
+habilita o ambiente worker). Se o main.js carregado é de uma compilação anterior, os blocos são resolvidos com
+comparative_boards na thread da interface (src/legacyBoards.ts), devolvendo o controle ao navegador entre os blocos.
+*/
+export class SolverRunner {
+  private workers: Worker[] = [];
+  private runId = 0;
+  private cancelCurrent: (() => void) | null = null;
+  private readonly workerCount: number;
+  private readonly chunkSize: number;
+  private readonly nativeChunkSize: number;
+  private native: Promise<NativeSolverApi | null> | null = null;
+  private legacy: Promise<any | null> | null = null;
+
+  constructor(workerCount = Math.min(navigator.hardwareConcurrency || 1, 8), chunkSize = 64, nativeChunkSize = 8192) {
+    this.workerCount = Math.max(1, workerCount);
+    this.chunkSize = chunkSize;
+    this.nativeChunkSize = nativeChunkSize;
+  }
+
+  private nativeBackend(): Promise<NativeSolverApi | null> {
+    this.native ??= (async () => {
+      const api = nativeSolverApi();
+      try {
+        return api && (await api.info()).available ? api : null;
+      } catch {
+        return null;
+      }
+    })();
+    return this.native;
+  }
+
+  // Módulo WASM carregado na thread da interface, se ele não tiver a versão numérica dos quadros (null se tiver)
+  private legacyModule(): Promise<any | null> {
+    this.legacy ??= import('../RootFinders/main.js')
+      .then(({ default: Module }) => Module())
+      .then(wasmModule => hasNumericBoards(wasmModule) ? null : wasmModule);
+    return this.legacy;
+  }
+
+  // 'native' se os quadros serão resolvidos pelo addon, 'wasm' se pelo módulo WASM
+  async backend(): Promise<'native' | 'wasm'> {
+    return (await this.nativeBackend()) ? 'native' : 'wasm';
+  }
+
+  private ensureWorkers() {
+    while (this.workers.length < this.workerCount) {
+      this.workers.push(new Worker(new URL('./solverWorker.ts', import.meta.url), { type: 'module' }));
+    }
+  }
+
+  async run(params: RunParams, callbacks: RunCallbacks): Promise<RunStatus> {
+    this.cancel();
+    const runId = this.runId;
+    const native = await this.nativeBackend();
+    if (runId !== this.runId) {
+      return 'cancelled';
+    }
+    if (native) {
+      const status = await this.runNative(native, params, callbacks);
+      if (status !== 'unavailable') {
+        return status;
+      }
+      this.native = Promise.resolve(null);
+    }
+    const legacy = await this.legacyModule();
+    if (runId !== this.runId) {
+      return 'cancelled';
+    }
+    return legacy ? this.runMainThread(legacy, params, callbacks) : this.runWorkers(params, callbacks);
+  }
+
+  private async runMainThread(wasmModule: any, params: RunParams, callbacks: RunCallbacks): Promise<RunStatus> {
+    let cancelled = false;
+    const cancel = () => { cancelled = true; };
+    this.cancelCurrent = cancel;
+    try {
+      applyFunction(wasmModule, params.funcao);
+      const total = params.a_foguetes.length;
+      const builder = new NumericBoardsBuilder(total);
+      const delivery = throttledBoards(builder, callbacks.onBoards);
+      for (let start = 0; start < total; start += this.chunkSize) {
+        builder.append(legacyNumericBoards(
+          wasmModule, params.a_foguetes.slice(start, start + this.chunkSize), params.epsolon, params.max_iter
+        ));
+        delivery.update();
+        callbacks.onProgress(builder.size, total);
+        // Deixa a interface atualizar (e cancel() ser chamado) antes do próximo bloco
+        await new Promise(resolve => setTimeout(resolve));
+        if (cancelled) {
+          delivery.cancel();
+          return 'cancelled';
+        }
+      }
+      delivery.flush();
+      return 'done';
+    } finally {
+      if (this.cancelCurrent === cancel) {
+        this.cancelCurrent = null;
+      }
+    }
+  }
+
+  private async runNative(api: NativeSolverApi, params: RunParams, callbacks: RunCallbacks): Promise<RunStatus | 'unavailable'> {
+    let cancelled = false;
+    const cancel = () => { cancelled = true; };
+    this.cancelCurrent = cancel;
+    try {
+      const total = params.a_foguetes.length;
+      const builder = new NumericBoardsBuilder(total);
+      const delivery = throttledBoards(builder, callbacks.onBoards);
+      for (let start = 0; start < total; start += this.nativeChunkSize) {
+        let reply: Awaited<ReturnType<NativeSolverApi['comparativeBoards']>>;
+        try {
+          reply = await api.comparativeBoards({
+            ...params,
+            a_foguetes: params.a_foguetes.slice(start, start + this.nativeChunkSize),
+          });
+        } catch (error) {
+          delivery.cancel();
+          console.warn('Addon nativo indisponível, usando WebAssembly:', error);
+          return 'unavailable';
+        }
+        if (cancelled) {
+          delivery.cancel();
+          return 'cancelled';
+        }
+        if ('error' in reply) {
+          delivery.cancel();
+          throw new Error(reply.error);
+        }
+        builder.append(reply.boards);
+        delivery.update();
+        callbacks.onProgress(builder.size, total);
+      }
+      delivery.flush();
+      return 'done';
+    } finally {
+      if (this.cancelCurrent === cancel) {
+        this.cancelCurrent = null;
+      }
+    }
+  }
+
+  private runWorkers(params: RunParams, callbacks: RunCallbacks): Promise<RunStatus> {
+    this.ensureWorkers();
+
+    const runId = ++this.runId;
+    const total = params.a_foguetes.length;
+    const chunkCount = Math.ceil(total / this.chunkSize);
+    const results: (NumericBoards | undefined)[] = new Array(chunkCount);
+    const builder = new NumericBoardsBuilder(total);
+    const delivery = throttledBoards(builder, callbacks.onBoards);
+    let nextToMerge = 0;    // Próximo bloco a ser entregue, em ordem
+    let done = 0;
+    let cancelled = false;
+
+    return new Promise<RunStatus>((resolve, reject) => {
+      const finish = (status: RunStatus) => {
+        this.workers.forEach(w => { w.onmessage = null; });
+        if (status === 'done') {
+          delivery.flush();
+        } else {
+          delivery.cancel();
+        }
+        if (this.cancelCurrent === cancel) {
+          this.cancelCurrent = null;
+        }
+        resolve(status);
+      };
+
+      const cancel = () => {
+        cancelled = true;
+        finish('cancelled');
+      };
+      this.cancelCurrent = cancel;
+
+      const dispatch = (worker: Worker, chunk: number) => {
+        if (cancelled || chunk >= chunkCount) {
+          return;
+        }
+        const request: SolveRequest = {
+          runId,
+          chunk,
+          a_foguetes: params.a_foguetes.slice(chunk * this.chunkSize, (chunk + 1) * this.chunkSize),
+          epsolon: params.epsolon,
+          max_iter: params.max_iter,
+          trace: params.trace,
+          funcao: params.funcao,
+        };
+        worker.postMessage(request);
+      };
+
+      if (chunkCount === 0) {
+        finish('done');
+        return;
+      }
+
+      this.workers.forEach((worker, w) => {
+        worker.onmessage = (event: MessageEvent<WorkerMessage>) => {
+          const message = event.data;
+          if (message.runId !== runId || cancelled) {
+            return;
+          }
+          if (message.type === 'error') {
+            cancelled = true;
+            this.workers.forEach(w => { w.onmessage = null; });
+            delivery.cancel();
+            reject(new Error(message.message));
+            return;
+          }
+
+          results[message.chunk] = message.boards;
+          done += message.boards.count;
+          dispatch(worker, message.chunk + this.workers.length);
+
+          // Junta os blocos que já formam um prefixo contíguo da lista
+          let advanced = false;
+          while (nextToMerge < chunkCount && results[nextToMerge]) {
+            builder.append(results[nextToMerge]!);
+            results[nextToMerge++] = undefined;
+            advanced = true;
+          }
+          if (advanced) {
+            delivery.update();
+          }
+          callbacks.onProgress(done, total);
+
+          if (nextToMerge === chunkCount) {
+            finish('done');
+          }
+        };
+        dispatch(worker, w);
+      });
+    });
+  }
+
+  // Envia request a todos os workers e junta as respostas, que chegam por um MessageChannel próprio (sem interferir
+  // com os handlers de run)
+  private query<T>(request: MetricsRequest | CacheRequest): Promise<T[]> {
+    this.ensureWorkers();
+    return Promise.all(this.workers.map(worker => new Promise<T>(resolve => {
+      const channel = new MessageChannel();
+      channel.port1.onmessage = (event: MessageEvent<T>) => {
+        channel.port1.close();
+        resolve(event.data);
+      };
+      worker.postMessage(request, [channel.port2]);
+    })));
+  }
+
+  // Métricas dos métodos somadas entre os workers (cada um tem sua instância do módulo WASM), ou as do módulo da
+  // thread da interface quando ele é de uma compilação anterior aos workers
+  async metrics(reset = false): Promise<SolverMetrics> {
+    const legacy = await this.legacyModule();
+    if (legacy) {
+      return readMetrics(legacy, reset);
+    }
+    return mergeMetrics(await this.query<SolverMetrics>({ type: 'metrics', reset }));
+  }
+
+  // Estatísticas do cache de resultados do backend em uso: o do addon nativo, a soma dos caches dos workers ou o do
+  // módulo da thread da interface (como em metrics). capacity troca o limite de bytes de cada cache
+  async cacheStats(options: { capacity?: number; clear?: boolean } = {}): Promise<CacheStats> {
+    const native = await this.nativeBackend();
+    if (native) {
+      return native.cacheStats(options);
+    }
+    const legacy = await this.legacyModule();
+    if (legacy) {
+      return readCacheStats(legacy, options);
+    }
+    return mergeCacheStats(await this.query<CacheStats>({ type: 'cache', ...options }));
+  }
+
+  cancel() {
+    this.runId++;
+    this.cancelCurrent?.();
+  }
+
+  dispose() {
+    this.cancel();
+    this.workers.forEach(w => w.terminate());
+    this.workers = [];
+  }
+}
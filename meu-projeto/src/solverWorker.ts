@@ -0,0 +1,65 @@
+// Web Worker que executa o módulo WebAssembly fora da thread da interface. Cada mensagem pede a resolução de um
+// bloco de valores de a; a resposta carrega os quadros numéricos do bloco, com os buffers transferidos (sem cópia).
+// Um MetricsRequest ou CacheRequest pede as métricas dos métodos ou as estatísticas do cache de resultados desta
+// instância do módulo, respondidas pela porta que acompanha a mensagem
+import Module from '../RootFinders/main.js';
+import { copyNumericBoards } from './numericBoards';
+import { applyFunction } from './legacyBoards';
+import { readCacheStats, readMetrics } from './solverMetrics';
+
+export interface SolveRequest {
+  runId: number;
+  chunk: number;
+  a_foguetes: number[];
+  epsolon: number;
+  max_iter: number;
+  trace: boolean;
+  funcao: string; // Expressão em a e d (vazia = a*d - d*log(d))
+}
+
+export interface MetricsRequest {
+  type: 'metrics';
+  reset: boolean; // Zera os contadores depois da leitura
+}
+
+export interface CacheRequest {
+  type: 'cache';
+  capacity?: number; // Novo limite de bytes do cache
+  clear?: boolean;   // Esvazia o cache (e zera os contadores) depois da leitura
+}
+
+let modulePromise: Promise<any> | null = null;
+
+const answerMetrics = async (request: MetricsRequest, port: MessagePort) => {
+  modulePromise ??= Module();
+  port.postMessage(readMetrics(await modulePromise, request.reset));
+};
+
+const answerCache = async (request: CacheRequest, port: MessagePort) => {
+  modulePromise ??= Module();
+  port.postMessage(readCacheStats(await modulePromise, request));
+};
+
+self.onmessage = async (event: MessageEvent<SolveRequest | MetricsRequest | CacheRequest>) => {
+  if ('type' in event.data) {
+    await (event.data.type === 'metrics'
+      ? answerMetrics(event.data, event.ports[0])
+      : answerCache(event.data, event.ports[0]));
+    return;
+  }
+  const { runId, chunk, a_foguetes, epsolon, max_iter, trace, funcao } = event.data;
+  try {
+    modulePromise ??= Module();
+    const wasmModule = await modulePromise;
+    applyFunction(wasmModule, funcao);
+    const boards = copyNumericBoards(
+      wasmModule.comparative_boards_numeric(Float64Array.from(a_foguetes), epsolon, max_iter, trace)
+    );
+    self.postMessage(
+      { type: 'result', runId, chunk, boards },
+      { transfer: [boards.doubles.buffer, boards.ints.buffer, boards.trace.buffer] }
+    );
+  } catch (error) {
+    self.postMessage({ type: 'error', runId, chunk, message: error instanceof Error ? error.message : String(error) });
+  }
+};
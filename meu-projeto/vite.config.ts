@@ -41,6 +41,10 @@ export default defineConfig({
     renderer()
   ],
   base: './',
+  // solverWorker.ts é um module worker (importa o main.js do Emscripten)
+  worker: {
+    format: 'es'
+  },
   build: {
     outDir: 'dist',
     emptyOutDir: true